@@ -0,0 +1,159 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/system/fiber_priority_scheduler.hpp"
+#include "internal/system/fiber_stack_pool.hpp"
+
+#include <benchmark/benchmark.h>
+#include <boost/fiber/fiber.hpp>
+#include <boost/fiber/fixedsize_stack.hpp>
+#include <boost/fiber/protected_fixedsize_stack.hpp>
+#include <boost/fiber/operations.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace srf::internal::system;
+
+/**
+ * Measures the cost of a context switch through the FiberPriorityScheduler as the number of ready fibers grows.
+ *
+ * Each iteration yields the benchmarking fiber once, which cycles through every ready fiber before the benchmarking
+ * fiber runs again; items processed is the number of context switches. With a constant time ready queue, the time
+ * per item is independent of the number of ready fibers.
+ */
+static void fiber_priority_scheduler_yield(benchmark::State& state)
+{
+    const auto fiber_count = state.range(0);
+
+    std::thread runner([&state, fiber_count] {
+        boost::fibers::use_scheduling_algorithm<FiberPriorityScheduler>();
+
+        std::atomic<bool> running{true};
+        std::vector<boost::fibers::fiber> fibers;
+        fibers.reserve(fiber_count);
+        for (std::int64_t i = 0; i < fiber_count; i++)
+        {
+            fibers.emplace_back([&running] {
+                while (running.load(std::memory_order_relaxed))
+                {
+                    boost::this_fiber::yield();
+                }
+            });
+        }
+
+        for (auto _ : state)
+        {
+            boost::this_fiber::yield();
+        }
+
+        running = false;
+        for (auto& fiber : fibers)
+        {
+            fiber.join();
+        }
+    });
+
+    runner.join();
+    state.SetItemsProcessed(state.iterations() * (fiber_count + 1));
+}
+
+/**
+ * Each iteration launches the ready fibers across several priority classes; every fiber yields a fixed number of
+ * times before completing and the benchmarking fiber joins them all. Items processed is the number of yields.
+ */
+static void fiber_priority_scheduler_yield_mixed_priorities(benchmark::State& state)
+{
+    constexpr int yield_count = 8;
+    const auto fiber_count    = state.range(0);
+
+    std::thread runner([&state, fiber_count] {
+        boost::fibers::use_scheduling_algorithm<FiberPriorityScheduler>();
+
+        std::vector<boost::fibers::fiber> fibers;
+        fibers.reserve(fiber_count);
+
+        for (auto _ : state)
+        {
+            for (std::int64_t i = 0; i < fiber_count; i++)
+            {
+                fibers.emplace_back([] {
+                    for (int j = 0; j < yield_count; j++)
+                    {
+                        boost::this_fiber::yield();
+                    }
+                });
+                fibers.back().properties<FiberPriorityProps>().set_priority(static_cast<int>(i % 4));
+            }
+
+            for (auto& fiber : fibers)
+            {
+                fiber.join();
+            }
+            fibers.clear();
+        }
+    });
+
+    runner.join();
+    state.SetItemsProcessed(state.iterations() * fiber_count * yield_count);
+}
+
+/**
+ * Launch and join a short-lived fiber using the default boost stack allocator, which maps and unmaps a stack per fiber.
+ */
+static void fiber_launch_fixedsize_stack(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        boost::fibers::fiber fiber(std::allocator_arg, boost::fibers::fixedsize_stack(), [] {});
+        fiber.join();
+    }
+}
+
+/**
+ * Launch and join a short-lived fiber on a freshly mapped stack with a guard page.
+ */
+static void fiber_launch_protected_fixedsize_stack(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        boost::fibers::fiber fiber(std::allocator_arg, boost::fibers::protected_fixedsize_stack(), [] {});
+        fiber.join();
+    }
+}
+
+/**
+ * Launch and join a short-lived fiber with a stack recycled from a FiberStackPool.
+ */
+static void fiber_launch_pooled_stack(benchmark::State& state)
+{
+    auto pool = std::make_shared<FiberStackPool>(0, true, 16);
+    for (auto _ : state)
+    {
+        boost::fibers::fiber fiber(std::allocator_arg, PooledStackAllocator(pool), [] {});
+        fiber.join();
+    }
+}
+
+BENCHMARK(fiber_launch_fixedsize_stack);
+BENCHMARK(fiber_launch_protected_fixedsize_stack);
+BENCHMARK(fiber_launch_pooled_stack);
+BENCHMARK(fiber_priority_scheduler_yield)->RangeMultiplier(4)->Range(16, 1024)->UseRealTime();
+BENCHMARK(fiber_priority_scheduler_yield_mixed_priorities)->RangeMultiplier(4)->Range(16, 1024)->UseRealTime();
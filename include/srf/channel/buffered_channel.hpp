@@ -39,6 +39,11 @@ class BufferedChannel final : public Channel<T>
         return status(m_channel.push(std::move(val)));
     }
 
+    inline Status do_try_write(T&& val) final
+    {
+        return status(m_channel.try_push(std::move(val)));
+    }
+
     inline Status do_await_read(T& val) final
     {
         return status(m_channel.pop(std::ref(val)));
@@ -66,6 +66,11 @@ class Channel : public Ingress<T>, public Egress<T>, public Watchable, public Ch
 
     inline Status await_write(T&& t) final;
     using Ingress<T>::await_write;
+    inline Status try_write(T&& t) final;
+    bool supports_try_write() const final
+    {
+        return true;
+    }
 
     inline Status await_read(T& t) final;
     Status await_read_until(T& t, const time_point_t& tp) final;
@@ -76,6 +81,7 @@ class Channel : public Ingress<T>, public Egress<T>, public Watchable, public Ch
 
   private:
     virtual Status do_await_write(T&&) = 0;
+    virtual Status do_try_write(T&&)   = 0;
 
     virtual Status do_await_read(T&)                            = 0;
     virtual Status do_await_read_until(T&, const time_point_t&) = 0;
@@ -94,6 +100,15 @@ inline Status Channel<T>::await_write(T&& t)
     return rc;
 }
 
+template <typename T>
+inline Status Channel<T>::try_write(T&& t)
+{
+    WATCHER_PROLOGUE(WatchableEvent::channel_write);
+    auto rc = do_try_write(std::move(t));
+    WATCHER_EPILOGUE(WatchableEvent::channel_write, rc == Status::success);
+    return rc;
+}
+
 template <typename T>
 inline Status Channel<T>::await_read(T& t)
 {
@@ -43,6 +43,26 @@ struct Ingress : public IngressHandle
 
     virtual Status await_write(T&&) = 0;
 
+    /**
+     * @brief Attempt to write without yielding the calling fiber.
+     *
+     * On Status::full the value is left untouched so the caller may offer it elsewhere. Implementations which are
+     * unable to perform a non-blocking write fall back to await_write and report false from supports_try_write.
+     */
+    virtual Status try_write(T&& t)
+    {
+        return await_write(std::move(t));
+    }
+
+    /**
+     * @brief True if try_write never yields on this path; callers which must not block, or which need to observe
+     * Status::full, should only use try_write on ingresses which return true.
+     */
+    virtual bool supports_try_write() const
+    {
+        return false;
+    }
+
     // If the above overload cannot be matched, copy by value and move into the await_write(T&&) overload. This is only
     // necessary for lvalues. The template parameters give it lower priority in overload resolution.
     template <typename TT = T, typename = std::enable_if_t<std::is_copy_constructible_v<TT>>>
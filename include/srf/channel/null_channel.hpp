@@ -41,6 +41,11 @@ class NullChannel : public Channel<T>
         return Status::success;
     }
 
+    Status do_try_write(T&& t) override
+    {
+        return do_await_write(std::move(t));
+    }
+
     Status do_await_read(T& t) override
     {
         std::unique_lock<Mutex> lock(m_mutex);
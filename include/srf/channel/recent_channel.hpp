@@ -53,6 +53,12 @@ class RecentChannel : public Channel<T>
         return Status::success;
     }
 
+    Status do_try_write(T&& data) override
+    {
+        // writes never block; the oldest value is dropped when full
+        return do_await_write(std::move(data));
+    }
+
     Status do_await_read(T& data) override
     {
         std::unique_lock<Mutex> lock(m_mutex);
@@ -0,0 +1,591 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/codable/codable_protocol.hpp>
+#include <srf/codable/contiguous_types.hpp>
+#include <srf/codable/detail/reflection.hpp>
+#include <srf/codable/encoded_object.hpp>
+#include <srf/codable/encoding_options.hpp>
+#include <srf/exceptions/runtime_error.hpp>
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace srf::codable {
+
+/**
+ * @brief Enables the reflection based codable_protocol for plain aggregates
+ *
+ * Aggregates with up to detail::max_reflectable_fields fields whose field types are all packable are codable without
+ * a user-provided protocol. Types that provide serialize/deserialize members, opt into is_trivially_codable or are
+ * std::array are excluded, as are aggregates with base classes or C-array members. Specialize to std::false_type to disable reflection for a type, e.g. when providing a
+ * partially specialized codable_protocol for it.
+ */
+template <typename T, typename = void>
+struct is_reflectable : std::false_type
+{};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_flat_v = std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                                  (is_trivially_codable<T>::value && std::is_trivially_copyable_v<T>);
+
+template <typename T>
+constexpr bool is_reflectable_aggregate()
+{
+    if constexpr (std::is_class_v<T> && std::is_aggregate_v<T> && !is_flat_v<T> && !is_std_array<T>::value &&
+                  !has_codable_members<T>::value)
+    {
+        return has_reflectable_fields<T>();
+    }
+    else
+    {
+        return false;
+    }
+}
+
+}  // namespace detail
+
+template <typename T>
+struct is_reflectable<T, std::enable_if_t<detail::is_reflectable_aggregate<T>()>> : std::true_type
+{};
+
+namespace detail {
+
+// packable - types which can be written to and read from a single packed byte buffer
+
+template <typename T, typename = void>
+struct is_packable : std::false_type
+{};
+
+template <typename T>
+struct is_packable<T, std::enable_if_t<is_flat_v<T>>> : std::true_type
+{};
+
+template <>
+struct is_packable<std::string> : std::true_type
+{};
+
+template <typename T, typename AllocatorT>
+struct is_packable<std::vector<T, AllocatorT>, std::enable_if_t<!std::is_same_v<T, bool>>> : is_packable<T>
+{};
+
+template <typename T, std::size_t N>
+struct is_packable<std::array<T, N>> : is_packable<T>
+{};
+
+template <typename T1, typename T2>
+struct is_packable<std::pair<T1, T2>> : std::conjunction<is_packable<T1>, is_packable<T2>>
+{};
+
+template <typename... Ts>
+struct is_packable<std::tuple<Ts...>> : std::conjunction<is_packable<Ts>...>
+{};
+
+template <typename T>
+struct is_packable<std::optional<T>> : is_packable<T>
+{};
+
+template <typename... Ts>
+struct is_packable<std::variant<Ts...>> : std::conjunction<is_packable<Ts>...>
+{};
+
+template <typename KeyT, typename ValueT, typename CompareT, typename AllocatorT>
+struct is_packable<std::map<KeyT, ValueT, CompareT, AllocatorT>>
+  : std::conjunction<is_packable<KeyT>, is_packable<ValueT>>
+{};
+
+template <typename KeyT, typename ValueT, typename HashT, typename EqualT, typename AllocatorT>
+struct is_packable<std::unordered_map<KeyT, ValueT, HashT, EqualT, AllocatorT>>
+  : std::conjunction<is_packable<KeyT>, is_packable<ValueT>>
+{};
+
+template <typename TupleT>
+struct are_fields_packable;
+
+template <typename... FieldsT>
+struct are_fields_packable<std::tuple<FieldsT...>>
+  : std::conjunction<is_packable<std::remove_cv_t<std::remove_reference_t<FieldsT>>>...>
+{};
+
+template <typename T>
+struct is_packable<T, std::enable_if_t<is_reflectable<T>::value>>
+  : are_fields_packable<decltype(tie_fields(std::declval<T&>()))>
+{};
+
+/**
+ * @brief Counts the bytes written by a packer without writing them
+ */
+class PackedSizer final
+{
+  public:
+    void write(const void* /*data*/, std::size_t bytes)
+    {
+        m_bytes += bytes;
+    }
+
+    std::size_t bytes() const
+    {
+        return m_bytes;
+    }
+
+  private:
+    std::size_t m_bytes{0};
+};
+
+class PackedWriter final
+{
+  public:
+    PackedWriter(void* data, std::size_t bytes) : m_data(static_cast<std::byte*>(data)), m_bytes(bytes) {}
+
+    void write(const void* data, std::size_t bytes)
+    {
+        DCHECK_LE(m_offset + bytes, m_bytes);
+        std::memcpy(m_data + m_offset, data, bytes);
+        m_offset += bytes;
+    }
+
+  private:
+    std::byte* m_data;
+    std::size_t m_bytes;
+    std::size_t m_offset{0};
+};
+
+class PackedReader final
+{
+  public:
+    PackedReader(const void* data, std::size_t bytes) : m_data(static_cast<const std::byte*>(data)), m_bytes(bytes)
+    {}
+
+    void read(void* data, std::size_t bytes)
+    {
+        if (m_offset + bytes > m_bytes)
+        {
+            throw exceptions::SrfRuntimeError("packed encoding is truncated");
+        }
+        std::memcpy(data, m_data + m_offset, bytes);
+        m_offset += bytes;
+    }
+
+    std::size_t remaining() const
+    {
+        return m_bytes - m_offset;
+    }
+
+  private:
+    const std::byte* m_data;
+    std::size_t m_bytes;
+    std::size_t m_offset{0};
+};
+
+template <typename WriterT>
+void pack_size(WriterT& writer, std::size_t size)
+{
+    auto value = static_cast<std::uint64_t>(size);
+    writer.write(&value, sizeof(value));
+}
+
+inline std::size_t unpack_size(PackedReader& reader)
+{
+    std::uint64_t value;
+    reader.read(&value, sizeof(value));
+    return value;
+}
+
+template <typename T, typename = void>
+struct packer;  // NOLINT(readability-identifier-naming)
+
+template <typename T, typename WriterT>
+void pack(WriterT& writer, const T& t)
+{
+    packer<T>::pack(writer, t);
+}
+
+template <typename T>
+T unpack(PackedReader& reader)
+{
+    return packer<T>::unpack(reader);
+}
+
+template <typename T>
+struct packer<T, std::enable_if_t<is_flat_v<T>>>
+{
+    template <typename WriterT>
+    static void pack(WriterT& writer, const T& t)
+    {
+        writer.write(&t, sizeof(T));
+    }
+
+    static T unpack(PackedReader& reader)
+    {
+        T t;
+        reader.read(&t, sizeof(T));
+        return t;
+    }
+};
+
+template <>
+struct packer<std::string>
+{
+    template <typename WriterT>
+    static void pack(WriterT& writer, const std::string& str)
+    {
+        pack_size(writer, str.size());
+        writer.write(str.data(), str.size());
+    }
+
+    static std::string unpack(PackedReader& reader)
+    {
+        std::string str(unpack_size(reader), '\0');
+        reader.read(str.data(), str.size());
+        return str;
+    }
+};
+
+template <typename T, typename AllocatorT>
+struct packer<std::vector<T, AllocatorT>>
+{
+    using vector_type = std::vector<T, AllocatorT>;
+
+    template <typename WriterT>
+    static void pack(WriterT& writer, const vector_type& vec)
+    {
+        pack_size(writer, vec.size());
+        if constexpr (is_flat_v<T>)
+        {
+            // coalesce the elements into a single write
+            writer.write(vec.data(), vec.size() * sizeof(T));
+        }
+        else
+        {
+            for (const auto& value : vec)
+            {
+                detail::pack(writer, value);
+            }
+        }
+    }
+
+    static vector_type unpack(PackedReader& reader)
+    {
+        auto size = unpack_size(reader);
+        vector_type vec;
+        if constexpr (is_flat_v<T>)
+        {
+            if (size * sizeof(T) > reader.remaining())
+            {
+                throw exceptions::SrfRuntimeError("packed encoding is truncated");
+            }
+            vec.resize(size);
+            reader.read(vec.data(), size * sizeof(T));
+        }
+        else
+        {
+            vec.reserve(std::min(size, reader.remaining()));
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                vec.push_back(detail::unpack<T>(reader));
+            }
+        }
+        return vec;
+    }
+};
+
+template <typename T, std::size_t N>
+struct packer<std::array<T, N>>
+{
+    using array_type = std::array<T, N>;
+
+    template <typename WriterT>
+    static void pack(WriterT& writer, const array_type& array)
+    {
+        if constexpr (is_flat_v<T>)
+        {
+            writer.write(array.data(), sizeof(T) * N);
+        }
+        else
+        {
+            for (const auto& value : array)
+            {
+                detail::pack(writer, value);
+            }
+        }
+    }
+
+    static array_type unpack(PackedReader& reader)
+    {
+        array_type array;
+        if constexpr (is_flat_v<T>)
+        {
+            reader.read(array.data(), sizeof(T) * N);
+        }
+        else
+        {
+            for (auto& value : array)
+            {
+                value = detail::unpack<T>(reader);
+            }
+        }
+        return array;
+    }
+};
+
+template <typename T1, typename T2>
+struct packer<std::pair<T1, T2>>
+{
+    template <typename WriterT>
+    static void pack(WriterT& writer, const std::pair<T1, T2>& pair)
+    {
+        detail::pack(writer, pair.first);
+        detail::pack(writer, pair.second);
+    }
+
+    static std::pair<T1, T2> unpack(PackedReader& reader)
+    {
+        // braced initialization guarantees left to right evaluation
+        return std::pair<T1, T2>{detail::unpack<T1>(reader), detail::unpack<T2>(reader)};
+    }
+};
+
+template <typename... Ts>
+struct packer<std::tuple<Ts...>>
+{
+    template <typename WriterT>
+    static void pack(WriterT& writer, const std::tuple<Ts...>& tuple)
+    {
+        std::apply([&writer](const auto&... values) { (detail::pack(writer, values), ...); }, tuple);
+    }
+
+    static std::tuple<Ts...> unpack(PackedReader& reader)
+    {
+        return std::tuple<Ts...>{detail::unpack<Ts>(reader)...};
+    }
+};
+
+template <typename T>
+struct packer<std::optional<T>>
+{
+    template <typename WriterT>
+    static void pack(WriterT& writer, const std::optional<T>& optional)
+    {
+        std::uint8_t has_value = optional.has_value() ? 1 : 0;
+        writer.write(&has_value, sizeof(has_value));
+        if (optional)
+        {
+            detail::pack(writer, *optional);
+        }
+    }
+
+    static std::optional<T> unpack(PackedReader& reader)
+    {
+        std::uint8_t has_value;
+        reader.read(&has_value, sizeof(has_value));
+        if (has_value == 0)
+        {
+            return std::nullopt;
+        }
+        return detail::unpack<T>(reader);
+    }
+};
+
+template <typename... Ts>
+struct packer<std::variant<Ts...>>
+{
+    using variant_type = std::variant<Ts...>;
+
+    template <typename WriterT>
+    static void pack(WriterT& writer, const variant_type& variant)
+    {
+        if (variant.valueless_by_exception())
+        {
+            throw exceptions::SrfRuntimeError("unable to encode a valueless variant");
+        }
+        auto index = static_cast<std::uint32_t>(variant.index());
+        writer.write(&index, sizeof(index));
+        std::visit([&writer](const auto& value) { detail::pack(writer, value); }, variant);
+    }
+
+    static variant_type unpack(PackedReader& reader)
+    {
+        std::uint32_t index;
+        reader.read(&index, sizeof(index));
+        return unpack_alternative<0>(index, reader);
+    }
+
+  private:
+    template <std::size_t I>
+    static variant_type unpack_alternative(std::uint32_t index, PackedReader& reader)
+    {
+        if constexpr (I < sizeof...(Ts))
+        {
+            if (index == I)
+            {
+                using alternative_type = std::variant_alternative_t<I, variant_type>;
+                return variant_type{std::in_place_index<I>, detail::unpack<alternative_type>(reader)};
+            }
+            return unpack_alternative<I + 1>(index, reader);
+        }
+        else
+        {
+            throw exceptions::SrfRuntimeError("packed variant index is out of range");
+        }
+    }
+};
+
+/**
+ * @brief Shared packer for std::map and std::unordered_map
+ */
+template <typename MapT, bool ReserveV>
+struct map_packer
+{
+    using key_type    = typename MapT::key_type;
+    using mapped_type = typename MapT::mapped_type;
+
+    template <typename WriterT>
+    static void pack(WriterT& writer, const MapT& map)
+    {
+        pack_size(writer, map.size());
+        for (const auto& [key, value] : map)
+        {
+            detail::pack(writer, key);
+            detail::pack(writer, value);
+        }
+    }
+
+    static MapT unpack(PackedReader& reader)
+    {
+        auto size = unpack_size(reader);
+        MapT map;
+        if constexpr (ReserveV)
+        {
+            map.reserve(std::min(size, reader.remaining()));
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            auto key   = detail::unpack<key_type>(reader);
+            auto value = detail::unpack<mapped_type>(reader);
+            map.emplace(std::move(key), std::move(value));
+        }
+        return map;
+    }
+};
+
+template <typename KeyT, typename ValueT, typename CompareT, typename AllocatorT>
+struct packer<std::map<KeyT, ValueT, CompareT, AllocatorT>>
+  : map_packer<std::map<KeyT, ValueT, CompareT, AllocatorT>, false>
+{};
+
+template <typename KeyT, typename ValueT, typename HashT, typename EqualT, typename AllocatorT>
+struct packer<std::unordered_map<KeyT, ValueT, HashT, EqualT, AllocatorT>>
+  : map_packer<std::unordered_map<KeyT, ValueT, HashT, EqualT, AllocatorT>, true>
+{};
+
+template <typename T>
+struct packer<T, std::enable_if_t<is_reflectable<T>::value>>
+{
+    template <typename WriterT>
+    static void pack(WriterT& writer, const T& t)
+    {
+        std::apply([&writer](const auto&... fields) { (detail::pack(writer, fields), ...); }, tie_fields(t));
+    }
+
+    static T unpack(PackedReader& reader)
+    {
+        T t{};
+        std::apply(
+            [&reader](auto&... fields) {
+                // the comma operator sequences the fields in declaration order
+                ((fields = detail::unpack<std::remove_cv_t<std::remove_reference_t<decltype(fields)>>>(reader)), ...);
+            },
+            tie_fields(t));
+        return t;
+    }
+};
+
+template <typename T>
+struct is_contiguous_container : std::false_type
+{};
+
+template <typename T, typename AllocatorT>
+struct is_contiguous_container<std::vector<T, AllocatorT>> : std::bool_constant<is_contiguous_element_v<T>>
+{};
+
+template <typename T, std::size_t N>
+struct is_contiguous_container<std::array<T, N>> : std::bool_constant<is_contiguous_element_v<T>>
+{};
+
+/**
+ * @brief Packable types handled by the composite codable_protocol, i.e. not already covered by the fundamental,
+ * std::string or contiguous protocols
+ */
+template <typename T>
+inline constexpr bool is_composite_v = is_packable<T>::value && !is_flat_v<T> && !std::is_same_v<T, std::string> &&
+                                       !is_contiguous_container<T>::value;
+
+}  // namespace detail
+
+/**
+ * @brief codable_protocol for composite types: std::pair, std::tuple, std::optional, std::variant, std::map,
+ * std::unordered_map, std::vector/std::array of non trivially copyable elements and reflectable aggregates
+ *
+ * The object is packed, field by field, into a single buffer described by a single descriptor. Packed encodings up to
+ * the eager threshold of the EncodingOptions are sent as an eager buffer; larger encodings are packed into one host
+ * buffer.
+ */
+template <typename T>
+struct codable_protocol<T, std::enable_if_t<detail::is_composite_v<T>>>
+{
+    static void serialize(const T& t, Encoded<T>& encoded, const EncodingOptions& opts)
+    {
+        auto guard = encoded.acquire_encoding_context();
+
+        detail::PackedSizer sizer;
+        detail::pack(sizer, t);
+
+        auto index = encoded.add_payload_buffer(sizer.bytes());
+        auto block = encoded.mutable_memory_block(index);
+        detail::PackedWriter writer(block.data(), block.bytes());
+        detail::pack(writer, t);
+    }
+
+    static T deserialize(const EncodedObject& encoded, std::size_t object_idx)
+    {
+        DCHECK_EQ(std::type_index(typeid(T)).hash_code(), encoded.type_index_hash_for_object(object_idx));
+        auto block = encoded.memory_block(encoded.start_idx_for_object(object_idx));
+        detail::PackedReader reader(block.data(), block.bytes());
+        return detail::unpack<T>(reader);
+    }
+};
+
+}  // namespace srf::codable
@@ -0,0 +1,78 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace srf::codable {
+
+/**
+ * @brief Codec applied to individual memory blocks of an EncodedObject
+ *
+ * The id of the Compressor is recorded in each compressed descriptor; decoding looks the Compressor up by id in the
+ * process-wide registry, so every codec used by a sender must be registered on the receiver.
+ */
+class Compressor
+{
+  public:
+    virtual ~Compressor() = default;
+
+    /**
+     * @brief Unique, non-zero identifier recorded in compressed descriptors; 0 denotes an uncompressed block
+     */
+    virtual std::uint32_t id() const = 0;
+
+    /**
+     * @brief Upper bound of the compressed size of a block of the given size
+     */
+    virtual std::size_t max_compressed_bytes(std::size_t bytes) const = 0;
+
+    /**
+     * @brief Compress src into dst
+     *
+     * @return std::size_t compressed size; 0 if the block is incompressible or does not fit in capacity
+     */
+    virtual std::size_t compress(const void* src, std::size_t bytes, void* dst, std::size_t capacity) const = 0;
+
+    /**
+     * @brief Decompress src into dst, which holds exactly the uncompressed size of the block
+     *
+     * @throws exceptions::SrfRuntimeError if src is not a valid compressed block of that size
+     */
+    virtual void decompress(const void* src, std::size_t bytes, void* dst, std::size_t uncompressed_bytes) const = 0;
+};
+
+/**
+ * @brief Built-in byte-oriented LZ77 codec; greedy hash matching, tuned for speed over ratio
+ */
+std::shared_ptr<const Compressor> lz_compressor();
+
+/**
+ * @brief Register a Compressor so that blocks compressed with it can be decoded; throws if the id is taken by a
+ * different Compressor
+ */
+void register_compressor(std::shared_ptr<const Compressor> compressor);
+
+/**
+ * @brief Look up a registered Compressor by id; the built-in codecs are always registered
+ */
+std::shared_ptr<const Compressor> find_compressor(std::uint32_t id);
+
+}  // namespace srf::codable
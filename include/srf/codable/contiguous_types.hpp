@@ -0,0 +1,202 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/codable/codable_protocol.hpp>
+#include <srf/codable/encoded_object.hpp>
+#include <srf/codable/encoding_options.hpp>
+#include <srf/exceptions/runtime_error.hpp>
+#include <srf/memory/block.hpp>
+#include <srf/memory/memory_kind.hpp>
+
+#include <glog/logging.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+namespace srf::codable {
+
+/**
+ * @brief Opt-in trait for trivially copyable structs which should be encoded as their object representation
+ *
+ * Specialize to std::true_type for a trivially copyable type to enable the built-in codable_protocol, e.g.
+ *
+ *     template <>
+ *     struct is_trivially_codable<MyPod> : std::true_type {};
+ *
+ * The object representation is sent as is, so the type must not hold pointers and both ends must agree on its layout.
+ */
+template <typename T, typename = void>
+struct is_trivially_codable : std::false_type
+{};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_contiguous_element_v = std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>;
+
+template <typename T>
+memory::const_block contiguous_block(const EncodedObject& encoded, std::size_t object_idx)
+{
+    DCHECK_EQ(std::type_index(typeid(T)).hash_code(), encoded.type_index_hash_for_object(object_idx));
+    return encoded.memory_block(encoded.start_idx_for_object(object_idx));
+}
+
+}  // namespace detail
+
+template <typename T, typename AllocatorT>
+struct codable_protocol<std::vector<T, AllocatorT>, std::enable_if_t<detail::is_contiguous_element_v<T>>>
+{
+    using vector_type = std::vector<T, AllocatorT>;
+
+    static void serialize(const vector_type& vec, Encoded<vector_type>& encoded, const EncodingOptions& opts)
+    {
+        const auto bytes = vec.size() * sizeof(T);
+        auto guard = encoded.acquire_encoding_context();
+        if (opts.force_copy())
+        {
+            auto index = encoded.add_payload_buffer(bytes);
+            auto block = encoded.mutable_memory_block(index);
+            std::memcpy(block.data(), vec.data(), bytes);
+        }
+        else
+        {
+            // above the eager threshold the encoding references the caller's memory, which must outlive it
+            encoded.add_host_block(memory::const_block(vec.data(), bytes, memory::memory_kind_type::host));
+        }
+    }
+
+    /**
+     * @brief Decodes into a vector using a default constructed AllocatorT; use a pooled allocator type, e.g.
+     * memory::host_allocator, to avoid a heap allocation per message
+     */
+    static vector_type deserialize(const EncodedObject& encoded, std::size_t object_idx)
+    {
+        auto block = detail::contiguous_block<vector_type>(encoded, object_idx);
+        DCHECK_EQ(block.bytes() % sizeof(T), 0);
+
+        vector_type vec(block.bytes() / sizeof(T));
+        std::memcpy(vec.data(), block.data(), block.bytes());
+        return vec;
+    }
+};
+
+template <typename T, std::size_t N>
+struct codable_protocol<std::array<T, N>, std::enable_if_t<detail::is_contiguous_element_v<T>>>
+{
+    using array_type = std::array<T, N>;
+
+    static void serialize(const array_type& array, Encoded<array_type>& encoded, const EncodingOptions& opts)
+    {
+        auto guard = encoded.acquire_encoding_context();
+        if (opts.force_copy())
+        {
+            auto index = encoded.add_payload_buffer(sizeof(array_type));
+            auto block = encoded.mutable_memory_block(index);
+            std::memcpy(block.data(), array.data(), sizeof(array_type));
+        }
+        else
+        {
+            // above the eager threshold the encoding references the caller's memory, which must outlive it
+            encoded.add_host_block(
+                memory::const_block(array.data(), sizeof(array_type), memory::memory_kind_type::host));
+        }
+    }
+
+    static array_type deserialize(const EncodedObject& encoded, std::size_t object_idx)
+    {
+        auto block = detail::contiguous_block<array_type>(encoded, object_idx);
+        CHECK_EQ(block.bytes(), sizeof(array_type));
+
+        array_type array;
+        std::memcpy(array.data(), block.data(), block.bytes());
+        return array;
+    }
+};
+
+template <typename T>
+struct codable_protocol<
+    T,
+    std::enable_if_t<is_trivially_codable<T>::value && std::is_trivially_copyable_v<T> && !std::is_fundamental_v<T>>>
+{
+    static_assert(std::is_default_constructible_v<T>, "trivially codable types must be default constructible");
+
+    static void serialize(const T& t, Encoded<T>& encoded, const EncodingOptions& opts)
+    {
+        auto guard = encoded.acquire_encoding_context();
+        if (opts.force_copy())
+        {
+            auto index = encoded.add_payload_buffer(sizeof(T));
+            auto block = encoded.mutable_memory_block(index);
+            std::memcpy(block.data(), &t, sizeof(T));
+        }
+        else
+        {
+            // above the eager threshold the encoding references the caller's memory, which must outlive it
+            encoded.add_host_block(memory::const_block(&t, sizeof(T), memory::memory_kind_type::host));
+        }
+    }
+
+    static T deserialize(const EncodedObject& encoded, std::size_t object_idx)
+    {
+        auto block = detail::contiguous_block<T>(encoded, object_idx);
+        CHECK_EQ(block.bytes(), sizeof(T));
+
+        T t;
+        std::memcpy(&t, block.data(), block.bytes());
+        return t;
+    }
+};
+
+/**
+ * @brief Decodes the contiguous payload of the object at object_idx into caller-provided storage
+ *
+ * Applies to objects encoded by the contiguous protocols above, i.e. std::vector<T>, std::array<T, N> and trivially
+ * codable structs (with count of 1). Elements are copied directly into data without constructing an intermediate
+ * container.
+ *
+ * @tparam ObjectT the encoded type, e.g. std::vector<float>
+ * @tparam T element type
+ * @param encoded
+ * @param object_idx
+ * @param data destination with room for count elements
+ * @param count
+ * @return std::size_t number of elements written
+ */
+template <typename ObjectT, typename T>
+std::size_t decode_into(const EncodedObject& encoded, std::size_t object_idx, T* data, std::size_t count)
+{
+    static_assert(detail::is_contiguous_element_v<T>, "decode_into requires a trivially copyable element type");
+
+    auto block = detail::contiguous_block<ObjectT>(encoded, object_idx);
+    DCHECK_EQ(block.bytes() % sizeof(T), 0);
+
+    auto elements = block.bytes() / sizeof(T);
+    if (elements > count)
+    {
+        throw exceptions::SrfRuntimeError("decode_into: destination is smaller than the encoded object");
+    }
+    std::memcpy(data, block.data(), block.bytes());
+    return elements;
+}
+
+}  // namespace srf::codable
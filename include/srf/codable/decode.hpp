@@ -21,7 +21,11 @@
 #include <srf/codable/type_traits.hpp>
 #include <srf/utils/sfinae_concept.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace srf::codable {
 
@@ -30,6 +34,11 @@ struct Decoder
 {
     static T deserialize(const EncodedObject& encoding, std::size_t object_idx)
     {
+        if (encoding.is_compressed(object_idx))
+        {
+            auto decompressed = encoding.decompress_objects(object_idx);
+            return detail::deserialize<T>(sfinae::full_concept{}, *decompressed, object_idx);
+        }
         return detail::deserialize<T>(sfinae::full_concept{}, encoding, object_idx);
     }
 };
@@ -40,4 +49,37 @@ auto decode(const EncodedObject& encoding, std::size_t object_idx = 0)
     return Decoder<T>::deserialize(encoding, object_idx);
 }
 
+/**
+ * @brief Decode count objects of type T starting at first_object; by default every object from first_object on
+ *
+ * Compressed objects of the batch are decompressed together, once, rather than per object.
+ */
+template <typename T>
+std::vector<T> decode_batch(const EncodedObject& encoding,
+                            std::size_t first_object = 0,
+                            std::size_t count        = std::numeric_limits<std::size_t>::max())
+{
+    DCHECK_LE(first_object, encoding.object_count());
+    count = std::min(count, encoding.object_count() - first_object);
+
+    std::unique_ptr<EncodedObject> decompressed;
+    for (std::size_t i = first_object; i < first_object + count; ++i)
+    {
+        if (encoding.is_compressed(i))
+        {
+            decompressed = encoding.decompress_objects(first_object, count);
+            break;
+        }
+    }
+    const auto& source = decompressed ? *decompressed : encoding;
+
+    std::vector<T> batch;
+    batch.reserve(count);
+    for (std::size_t i = first_object; i < first_object + count; ++i)
+    {
+        batch.push_back(detail::deserialize<T>(sfinae::full_concept{}, source, i));
+    }
+    return batch;
+}
+
 }  // namespace srf::codable
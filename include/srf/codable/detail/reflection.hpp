@@ -0,0 +1,263 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/codable/encoded_object.hpp>
+#include <srf/codable/encoding_options.hpp>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace srf::codable::detail {
+
+/**
+ * @brief Maximum number of fields of an aggregate that can be enumerated by reflection
+ */
+inline constexpr std::size_t max_reflectable_fields = 16;
+
+/**
+ * @brief Placeholder convertible to any field type; only used in unevaluated contexts to count aggregate fields
+ */
+struct any_field
+{
+    template <typename T>
+    operator T() const;  // NOLINT
+};
+
+/**
+ * @brief Placeholder convertible only to the proper base classes of T; aggregate initialization initializes bases first
+ */
+template <typename T>
+struct any_base_of
+{
+    template <typename BaseT, typename = std::enable_if_t<std::is_base_of_v<BaseT, T> && !std::is_same_v<BaseT, T>>>
+    operator BaseT() const;  // NOLINT
+};
+
+template <typename T, typename... ArgsT>
+auto is_brace_constructible(int) -> decltype(T{std::declval<ArgsT>()...}, std::true_type{});
+
+template <typename T, typename... ArgsT>
+std::false_type is_brace_constructible(...);
+
+// each initializer is braced, which prevents brace elision into C-array members
+template <typename T, typename... ArgsT>
+auto is_nested_brace_constructible(int) -> decltype(T{{std::declval<ArgsT>()}...}, std::true_type{});
+
+template <typename T, typename... ArgsT>
+std::false_type is_nested_brace_constructible(...);
+
+/**
+ * @brief Number of fields of aggregate T, i.e. the largest number of initializers accepted by aggregate initialization
+ */
+template <typename T, typename... ArgsT>
+constexpr std::size_t aggregate_field_count()
+{
+    if constexpr (sizeof...(ArgsT) > max_reflectable_fields)
+    {
+        return sizeof...(ArgsT);
+    }
+    else if constexpr (decltype(is_brace_constructible<T, ArgsT..., any_field>(0))::value)
+    {
+        return aggregate_field_count<T, ArgsT..., any_field>();
+    }
+    else
+    {
+        return sizeof...(ArgsT);
+    }
+}
+
+/**
+ * @brief Number of initializers accepted by aggregate initialization of T when each is braced
+ *
+ * Differs from aggregate_field_count when brace elision spreads initializers over the elements of a C-array member.
+ */
+template <typename T, typename... ArgsT>
+constexpr std::size_t braced_aggregate_field_count()
+{
+    if constexpr (sizeof...(ArgsT) > max_reflectable_fields)
+    {
+        return sizeof...(ArgsT);
+    }
+    else if constexpr (decltype(is_nested_brace_constructible<T, ArgsT..., any_field>(0))::value)
+    {
+        return braced_aggregate_field_count<T, ArgsT..., any_field>();
+    }
+    else
+    {
+        return sizeof...(ArgsT);
+    }
+}
+
+/**
+ * @brief True if the fields of aggregate T can be enumerated by tie_fields
+ *
+ * Structured bindings are not SFINAE friendly, so aggregates they would reject, or bind with a different number of
+ * names than aggregate_field_count, are detected up front: aggregates with base classes and aggregates with C-array
+ * members, which aggregate initialization miscounts through brace elision.
+ */
+template <typename T>
+constexpr bool has_reflectable_fields()
+{
+    constexpr auto count    = aggregate_field_count<T>();
+    constexpr auto has_base = decltype(is_brace_constructible<T, any_base_of<T>>(0))::value;
+    return count > 0 && count <= max_reflectable_fields && !has_base && braced_aggregate_field_count<T>() == count;
+}
+
+template <typename T, typename = void>
+struct has_serialize_member : std::false_type
+{};
+
+template <typename T>
+struct has_serialize_member<T, std::void_t<decltype(std::declval<T&>().serialize(std::declval<Encoded<T>&>()))>>
+  : std::true_type
+{};
+
+template <typename T, typename = void>
+struct has_serialize_with_options_member : std::false_type
+{};
+
+template <typename T>
+struct has_serialize_with_options_member<
+    T,
+    std::void_t<decltype(std::declval<T&>().serialize(std::declval<Encoded<T>&>(),
+                                                      std::declval<const EncodingOptions&>()))>> : std::true_type
+{};
+
+template <typename T, typename = void>
+struct has_deserialize_member : std::false_type
+{};
+
+template <typename T>
+struct has_deserialize_member<
+    T,
+    std::void_t<decltype(T::deserialize(std::declval<const EncodedObject&>(), std::declval<std::size_t>()))>>
+  : std::true_type
+{};
+
+/**
+ * @brief True if T provides its own serialize/deserialize members, which take precedence over reflection
+ */
+template <typename T>
+struct has_codable_members
+  : std::disjunction<has_serialize_member<T>, has_serialize_with_options_member<T>, has_deserialize_member<T>>
+{};
+
+template <typename T>
+struct is_std_array : std::false_type
+{};
+
+template <typename T, std::size_t N>
+struct is_std_array<std::array<T, N>> : std::true_type
+{};
+
+/**
+ * @brief Binds the fields of an aggregate by structured binding and returns them as a tuple of references
+ */
+template <typename T>
+auto tie_fields(T& t)
+{
+    constexpr auto N = aggregate_field_count<std::remove_cv_t<T>>();
+    static_assert(N > 0 && N <= max_reflectable_fields, "unsupported number of aggregate fields");
+
+    if constexpr (N == 1)
+    {
+        auto& [f0] = t;
+        return std::tie(f0);
+    }
+    else if constexpr (N == 2)
+    {
+        auto& [f0, f1] = t;
+        return std::tie(f0, f1);
+    }
+    else if constexpr (N == 3)
+    {
+        auto& [f0, f1, f2] = t;
+        return std::tie(f0, f1, f2);
+    }
+    else if constexpr (N == 4)
+    {
+        auto& [f0, f1, f2, f3] = t;
+        return std::tie(f0, f1, f2, f3);
+    }
+    else if constexpr (N == 5)
+    {
+        auto& [f0, f1, f2, f3, f4] = t;
+        return std::tie(f0, f1, f2, f3, f4);
+    }
+    else if constexpr (N == 6)
+    {
+        auto& [f0, f1, f2, f3, f4, f5] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5);
+    }
+    else if constexpr (N == 7)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6);
+    }
+    else if constexpr (N == 8)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+    }
+    else if constexpr (N == 9)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+    }
+    else if constexpr (N == 10)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+    }
+    else if constexpr (N == 11)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+    }
+    else if constexpr (N == 12)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+    }
+    else if constexpr (N == 13)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+    }
+    else if constexpr (N == 14)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+    }
+    else if constexpr (N == 15)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+    }
+    else if constexpr (N == 16)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = t;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+    }
+}
+
+}  // namespace srf::codable::detail
@@ -21,7 +21,9 @@
 #include <srf/codable/type_traits.hpp>
 #include <srf/utils/sfinae_concept.hpp>
 
+#include <iterator>
 #include <memory>
+#include <type_traits>
 
 namespace srf::codable {
 
@@ -30,7 +32,13 @@ struct Encoder
 {
     static void serialize(const T& t, Encoded<T>& enc, const EncodingOptions& opts = {})
     {
-        return detail::serialize(sfinae::full_concept{}, t, enc, opts);
+        enc.set_descriptor_format(opts.descriptor_format());
+        enc.set_eager_threshold(opts.eager_threshold());
+        detail::serialize(sfinae::full_concept{}, t, enc, opts);
+        if (opts.compressor())
+        {
+            enc.compress_object(enc.object_count() - 1, *opts.compressor(), opts.compression_threshold());
+        }
     }
 };
 
@@ -62,4 +70,28 @@ void encode(const T& t, Encoded<T>* enc, EncodingOptions opts = {})
     Encoder<T>::serialize(t, *enc, std::move(opts));
 }
 
+/**
+ * @brief Encode each element of range as consecutive objects of a single EncodedObject
+ *
+ * The objects share the descriptor storage of the EncodedObject and small host buffers are coalesced into shared
+ * slabs, so a batch of small objects travels as one message; see decode_batch.
+ */
+template <typename RangeT>
+void encode_batch(const RangeT& range, EncodedObject& encoding, const EncodingOptions& opts = {})
+{
+    using value_type = std::decay_t<decltype(*std::begin(range))>;  // NOLINT
+    for (const auto& t : range)
+    {
+        Encoder<value_type>::serialize(t, *reinterpret_cast<Encoded<value_type>*>(&encoding), opts);
+    }
+}
+
+template <typename RangeT>
+std::unique_ptr<EncodedObject> encode_batch(const RangeT& range, const EncodingOptions& opts = {})
+{
+    auto encoding = std::make_unique<EncodedObject>();
+    encode_batch(range, *encoding, opts);
+    return encoding;
+}
+
 }  // namespace srf::codable
@@ -19,6 +19,7 @@
 
 #include <srf/protos/codable.pb.h>
 #include <srf/codable/codable_protocol.hpp>
+#include <srf/codable/encoding_options.hpp>
 #include <srf/exceptions/runtime_error.hpp>
 #include <srf/memory/blob.hpp>
 #include <srf/memory/block.hpp>
@@ -30,13 +31,18 @@
 #include <google/protobuf/message.h>
 
 #include <cstddef>
-#include <map>
+#include <memory>
+#include <string>
 #include <typeindex>
 #include <utility>
 #include <vector>
 
 namespace srf::codable {
 
+namespace flat {
+class EncodedObjectView;
+}  // namespace flat
+
 /**
  * @brief Defines the sequence of memory regions (blobs) and meta data to encode an object.
  *
@@ -56,12 +62,19 @@ class EncodedObject
   public:
     /**
      * @brief ObjectDescriptor describing the encoded object.
+     *
+     * @note Descriptors received in the flat format are rebuilt as a protobuf message on first access.
+     *
      * @return const protos::ObjectDescriptor&
      */
     const protos::EncodedObject& proto() const;
 
     /**
-     * @brief Access const memory::block of the RemoteDescriptor at the required index
+     * @brief Access const memory::block of the RemoteDescriptor or EagerDescriptor at the required index
+     *
+     * Eager payloads are viewed in place as host memory, so decoders can read a payload without knowing which
+     * descriptor the eager threshold selected.
+     *
      * @return memory::const_block
      */
     memory::const_block memory_block(std::size_t idx) const;
@@ -110,14 +123,82 @@ class EncodedObject
      */
     std::size_t start_idx_for_object(std::size_t object_idx) const;
 
+    /**
+     * @brief Clears all descriptors, objects and owned buffers so the EncodedObject can be used for a new encoding.
+     *
+     * The descriptor messages and the host buffers of the previous encoding are kept as spares and handed out again by
+     * the add_* methods, so that a reused EncodedObject reaches a steady-state where encoding an object of a similar
+     * shape does not allocate. Device buffers and buffers still shared with a copy of this EncodedObject are released.
+     *
+     * @note Must not be called while an encoding context is held.
+     */
+    void reset();
+
+    /**
+     * @brief Wire format used when serializing the descriptors; selected by EncodingOptions::descriptor_format
+     */
+    DescriptorFormat descriptor_format() const;
+
+    void set_descriptor_format(DescriptorFormat format);
+
+    /**
+     * @brief Number of bytes required to serialize the descriptors in the selected wire format
+     */
+    std::size_t serialized_descriptor_bytes() const;
+
+    /**
+     * @brief Serialize the descriptors in the selected wire format to dst
+     *
+     * @return std::size_t number of bytes written
+     */
+    std::size_t serialize_descriptors(void* dst, std::size_t bytes) const;
+
+    /**
+     * @brief Replace the descriptors with those read from a serialized buffer of either wire format
+     *
+     * The format is detected from the buffer, so receivers accept both protobuf and flat encoded senders. A flat buffer
+     * is copied and then read in place through flat::EncodedObjectView by the accessors used to decode objects; the
+     * protobuf message is only rebuilt if proto(), eager_descriptor() or meta_data() is called or the EncodedObject is
+     * modified.
+     */
+    void deserialize_descriptors(const void* data, std::size_t bytes);
+
+    /**
+     * @brief Compress the eager and host memory blocks of the object at object_idx which are at least threshold_bytes
+     *
+     * Compressed blocks are held in buffers owned by EncodedObject; blocks that do not shrink are left as is.
+     */
+    void compress_object(std::size_t object_idx, const Compressor& compressor, std::size_t threshold_bytes);
+
+    /**
+     * @brief True if any descriptor of the object at object_idx holds a compressed block
+     */
+    bool is_compressed(std::size_t object_idx) const;
+
+    /**
+     * @brief Copy of this EncodedObject in which the descriptors of count objects starting at first_object are
+     * decompressed
+     *
+     * Used by decode so that codable_protocol::deserialize implementations never observe compressed blocks.
+     */
+    std::unique_ptr<EncodedObject> decompress_objects(std::size_t first_object, std::size_t count = 1) const;
+
+    /**
+     * @brief Payloads of at most this many bytes are inlined as eager buffers by add_host_block and
+     * add_payload_buffer; selected by EncodingOptions::eager_threshold
+     */
+    std::size_t eager_threshold() const;
+
+    void set_eager_threshold(std::size_t bytes);
+
   protected:
     /**
-     * @brief Access a mutable const_block at the requested index
+     * @brief Access a mutable block of the RemoteDescriptor or EagerDescriptor at the requested index
      *
      * @param idx
-     * @return memory::const_block
+     * @return memory::block
      */
-    memory::block mutable_memory_block(std::size_t idx) const;
+    memory::block mutable_memory_block(std::size_t idx);
 
     /**
      * @brief Converts a memory block to a RemoteDescriptor proto
@@ -160,12 +241,25 @@ class EncodedObject
      * @note The memory_resource backing the creation of the buffer<> comes from the SRF Runtime's thread local resource
      * object.
      *
+     * @note Buffers of at most max_coalesced_buffer_bytes are carved from slabs owned by the EncodedObject. The first
+     * slab is sized to the request and each new slab doubles up to coalesced_slab_bytes, so a single small encoding
+     * allocates only what it asked for while a batch of small objects shares a few slabs.
+     *
      * @param bytes
      * @param meta_data
      * @return std::size_t
      */
     std::size_t add_host_buffer(std::size_t bytes);
 
+    static constexpr std::size_t max_coalesced_buffer_bytes = 512;
+    static constexpr std::size_t coalesced_slab_bytes       = 8192;
+
+    /**
+     * @brief Upper bounds on the spare descriptor messages and host buffer bytes retained by reset
+     */
+    static constexpr std::size_t max_spare_descriptors       = 256;
+    static constexpr std::size_t max_spare_host_buffer_bytes = 256 * 1024;
+
     /**
      * @brief Add a buffer, owned by EncodedObject, that can be used to hold a contiguous block of data.
      *
@@ -184,12 +278,32 @@ class EncodedObject
      * @brief Add an eager buffer owned by EncodedObject. This buffer will be serialized and sent as part of the control
      * message.
      *
-     * Eager buffers are limited in size by compilation limits, SRF_MAX_EAGER_BUFFER_SIZE
+     * Prefer add_host_block or add_payload_buffer, which choose between eager and remote descriptors by size.
      *
      * @return std::size_t
      */
     std::size_t add_eager_buffer(const void* data, std::size_t bytes);
 
+    /**
+     * @brief Add a host memory region, choosing the descriptor by size
+     *
+     * Regions of at most eager_threshold() bytes are copied into an eager buffer; larger regions are referenced without
+     * a copy by a remote descriptor and must outlive the EncodedObject.
+     *
+     * @return std::size_t
+     */
+    std::size_t add_host_block(memory::const_block view);
+
+    /**
+     * @brief Add a writable buffer owned by EncodedObject, choosing the descriptor by size
+     *
+     * Buffers of at most eager_threshold() bytes are eager; larger buffers are host buffers described by a remote
+     * descriptor. Fill the buffer through mutable_memory_block with the returned index.
+     *
+     * @return std::size_t
+     */
+    std::size_t add_payload_buffer(std::size_t bytes);
+
     /**
      * @brief Basic guard object that must be acquried before being able to access the add_* or mutable_* methods
      */
@@ -223,9 +337,81 @@ class EncodedObject
      */
     void add_type_index(std::type_index type_index);
 
-    protos::EncodedObject m_proto;
-    std::map<std::size_t, memory::blob> m_buffers;
-    std::vector<std::pair<int, std::type_index>> m_object_info;  // typeindex and starting descriptor index
+    /**
+     * @brief Carve a host buffer from the current slab, allocating a new slab if the current one is exhausted
+     */
+    std::size_t add_coalesced_host_buffer(std::size_t bytes);
+
+    /**
+     * @brief Drop one descriptor reference to the owned buffer holding ptr, freeing the buffer with its last reference
+     */
+    void release_owned_buffer(const void* ptr);
+
+    /**
+     * @brief One past the last descriptor index of the object at object_idx
+     */
+    std::size_t end_idx_for_object(std::size_t object_idx) const;
+
+    /**
+     * @brief Rebuild m_proto from the flat descriptors held in m_flat, if any
+     */
+    void materialize() const;
+
+    /**
+     * @brief View of the flat descriptors held in m_flat; only valid while m_flat is not empty
+     */
+    flat::EncodedObjectView flat_view() const;
+
+    /**
+     * @brief Take the smallest spare host buffer of at least bytes, or allocate a new one if none fits
+     */
+    memory::blob take_host_buffer(std::size_t bytes);
+
+    /**
+     * @brief Descriptor messages and host buffers released by reset and reused by the next encoding
+     *
+     * Spares are not part of the encoded state, so a copy of an EncodedObject starts without any.
+     */
+    struct Spares
+    {
+        Spares() = default;
+        ~Spares() = default;
+
+        Spares(const Spares& /*other*/) {}
+        Spares& operator=(const Spares& /*other*/)
+        {
+            return *this;
+        }
+
+        Spares(Spares&&) noexcept = default;
+        Spares& operator=(Spares&&) noexcept = default;
+
+        std::vector<std::unique_ptr<protos::RemoteDescriptor>> remote_descs;
+        std::vector<std::unique_ptr<protos::EagerDescriptor>> eager_descs;
+        std::vector<std::unique_ptr<protos::MetaDataDescriptor>> meta_data_descs;
+        std::vector<memory::blob> host_buffers;
+        std::size_t host_buffer_bytes{0};
+    };
+
+    /**
+     * @brief Buffer owned by the EncodedObject with the number of remote descriptors that point into it
+     *
+     * A slab is referenced by every coalesced buffer carved from it.
+     */
+    struct OwnedBuffer
+    {
+        memory::blob blob;
+        std::size_t descriptors{0};
+    };
+
+    mutable protos::EncodedObject m_proto;  // rebuilt lazily from m_flat
+    mutable std::string m_flat;             // received flat descriptors; authoritative while not empty
+    std::vector<OwnedBuffer> m_buffers;     // referenced by the remote descriptors in m_proto
+    memory::block m_slab;                   // unused tail of the most recent slab for coalesced host buffers
+    std::size_t m_slab_bytes{0};            // size of the most recent slab
+    Spares m_spares;
+    std::size_t m_eager_threshold{default_eager_threshold()};
+    DescriptorFormat m_descriptor_format{DescriptorFormat::Protobuf};
     bool m_context_acquired{false};
     friend ContextGuard;
 };
@@ -256,7 +442,7 @@ template <typename MetaDataT>
 MetaDataT EncodedObject::meta_data(std::size_t idx) const
 {
     DCHECK_LT(idx, descriptor_count());
-    const auto& desc = m_proto.descriptors().at(idx);
+    const auto& desc = proto().descriptors().at(idx);
     CHECK(desc.has_meta_data_desc());
 
     MetaDataT meta_data;
@@ -274,8 +460,8 @@ std::size_t EncodedObject::add_buffer(memory::resource_view<PropertiesT...> view
     CHECK(m_context_acquired);
     memory::buffer<PropertiesT...> buff(bytes, view);
     memory::blob blob(std::move(buff));
-    auto index       = add_memory_block(blob);
-    m_buffers[index] = std::move(blob);
+    auto index = add_memory_block(blob);
+    m_buffers.push_back({std::move(blob), 1});
     return index;
 }
 
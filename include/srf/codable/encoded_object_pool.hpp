@@ -0,0 +1,71 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/codable/encoded_object.hpp>
+#include <srf/utils/macros.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace srf::codable {
+
+/**
+ * @brief Per-thread free list of reusable EncodedObjects.
+ *
+ * acquire() hands out an EncodedObject from the calling thread's pool, or a new one if the pool is empty. When the
+ * returned handle is destroyed, the EncodedObject is reset and returned to the pool of the thread on which it was
+ * released. Because reset keeps the descriptor messages and host buffers of the previous encoding for reuse, encoding
+ * objects of a similar shape into pooled EncodedObjects avoids heap allocation on the steady-state path.
+ *
+ * Each thread caches at most capacity() objects; surplus objects are freed on release.
+ */
+class EncodedObjectPool final
+{
+  public:
+    struct Releaser
+    {
+        void operator()(EncodedObject* encoded_object) const;
+    };
+
+    using handle_type = std::unique_ptr<EncodedObject, Releaser>;  // NOLINT
+
+    /**
+     * @brief Acquire a reset EncodedObject from the calling thread's pool
+     */
+    static handle_type acquire();
+
+    /**
+     * @brief Number of EncodedObjects currently cached by the calling thread's pool
+     */
+    static std::size_t size();
+
+    /**
+     * @brief Maximum number of EncodedObjects cached per thread
+     */
+    static std::size_t capacity();
+
+  private:
+    EncodedObjectPool()  = default;
+    ~EncodedObjectPool() = default;
+
+    DELETE_MOVEABILITY(EncodedObjectPool);
+    DELETE_COPYABILITY(EncodedObjectPool);
+};
+
+}  // namespace srf::codable
@@ -17,8 +17,34 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <utility>
+
 namespace srf::codable {
 
+class Compressor;
+
+/**
+ * @brief Process-wide default of EncodingOptions::eager_threshold; initially SRF_MAX_EAGER_BUFFER_SIZE
+ */
+std::size_t default_eager_threshold();
+
+void set_default_eager_threshold(std::size_t bytes);
+
+/**
+ * @brief Wire format used when the descriptors of an EncodedObject are serialized for transport
+ *
+ * Protobuf serializes the protos::EncodedObject message and is kept for compatibility. Flat is a fixed-layout,
+ * little-endian format which can be written without protobuf serialization and read in place without parsing; see
+ * srf/codable/flat_descriptor.hpp.
+ */
+enum class DescriptorFormat
+{
+    Protobuf,
+    Flat,
+};
+
 class EncodingOptions final
 {
   public:
@@ -29,8 +55,70 @@ class EncodingOptions final
         return m_force_copy;
     }
 
+    /**
+     * @brief payload blocks of at most bytes are inlined as eager buffers in the control message; larger blocks are
+     * described by remote descriptors
+     *
+     * Inlining small blocks saves the remote read of a round trip; inlining large blocks bloats the control message.
+     **/
+    EncodingOptions& eager_threshold(std::size_t bytes)
+    {
+        m_eager_threshold = bytes;
+        return *this;
+    }
+
+    std::size_t eager_threshold() const
+    {
+        return m_eager_threshold;
+    }
+
+    /**
+     * @brief select the wire format of the descriptors of the EncodedObject
+     **/
+    EncodingOptions& descriptor_format(DescriptorFormat format)
+    {
+        m_descriptor_format = format;
+        return *this;
+    }
+
+    DescriptorFormat descriptor_format() const
+    {
+        return m_descriptor_format;
+    }
+
+    /**
+     * @brief compress each host memory block of at least threshold_bytes with compressor
+     *
+     * The compressor id is recorded in the descriptor and decode transparently decompresses; see
+     * srf/codable/compression.hpp. Blocks which do not shrink are left uncompressed. Compressing a block which would
+     * otherwise be zero-copy implies a copy into a buffer owned by the EncodedObject.
+     **/
+    EncodingOptions& compression(std::shared_ptr<const Compressor> compressor,
+                                 std::size_t threshold_bytes = default_compression_threshold)
+    {
+        m_compressor            = std::move(compressor);
+        m_compression_threshold = threshold_bytes;
+        return *this;
+    }
+
+    const std::shared_ptr<const Compressor>& compressor() const
+    {
+        return m_compressor;
+    }
+
+    std::size_t compression_threshold() const
+    {
+        return m_compression_threshold;
+    }
+
+    static constexpr std::size_t default_compression_threshold = 4096;
+
   private:
     bool m_force_copy{false};
+    std::size_t m_eager_threshold{default_eager_threshold()};
+    DescriptorFormat m_descriptor_format{DescriptorFormat::Protobuf};
+    std::shared_ptr<const Compressor> m_compressor;
+    std::size_t m_compression_threshold{default_compression_threshold};
 };
 
 }  // namespace srf::codable
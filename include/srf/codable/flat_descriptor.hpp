@@ -0,0 +1,144 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/protos/codable.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Flat descriptor format
+ *
+ * A fixed-layout, little-endian alternative to the protobuf serialization of protos::EncodedObject. All fields are
+ * addressed by offset, so a received buffer can be inspected in place with flat::EncodedObjectView without parsing.
+ *
+ *   header       32 bytes   magic, version, flags, descriptor count, object count, object-level meta data
+ *   objects      16 bytes   per object: type_index_hash, desc_id
+ *   descriptors  56 bytes   per descriptor: kind, memory kind, ids, address, bytes, variable data offset/length,
+ *                           compression id and uncompressed bytes
+ *   data         variable   eager payloads, remote keys and serialized meta data, addressed by the tables above
+ *
+ * The magic is chosen so that the first byte can never start a valid protobuf serialization of protos::EncodedObject,
+ * which lets receivers accept both formats; see flat::is_flat.
+ */
+namespace srf::codable::flat {
+
+inline constexpr std::uint32_t magic   = 0x44465253;  // "SRFD"
+inline constexpr std::uint16_t version = 1;
+
+inline constexpr std::size_t header_bytes     = 32;
+inline constexpr std::size_t object_bytes     = 16;
+inline constexpr std::size_t descriptor_bytes = 56;
+
+enum class DescriptorKind : std::uint8_t
+{
+    Remote   = 1,
+    Packed   = 2,
+    Eager    = 3,
+    MetaData = 4,
+};
+
+/**
+ * @brief Number of bytes required to hold the flat encoding of proto
+ */
+std::size_t serialized_size(const protos::EncodedObject& proto);
+
+/**
+ * @brief Write the flat encoding of proto to dst; dst must hold at least serialized_size(proto) bytes
+ *
+ * @return std::size_t number of bytes written
+ */
+std::size_t serialize(const protos::EncodedObject& proto, void* dst, std::size_t bytes);
+
+/**
+ * @brief Rebuild a protos::EncodedObject from a flat encoding
+ */
+void deserialize(const void* data, std::size_t bytes, protos::EncodedObject& proto);
+
+/**
+ * @brief True if the buffer starts with a flat descriptor header
+ */
+bool is_flat(const void* data, std::size_t bytes);
+
+/**
+ * @brief Non-owning, zero-parse view of a flat encoding
+ *
+ * The constructor validates the header and table bounds; accessors read the fields in place.
+ */
+class EncodedObjectView final
+{
+  public:
+    EncodedObjectView(const void* data, std::size_t bytes);
+
+    std::size_t descriptor_count() const;
+    std::size_t object_count() const;
+
+    std::size_t type_index_hash_for_object(std::size_t object_idx) const;
+    std::size_t start_idx_for_object(std::size_t object_idx) const;
+
+    DescriptorKind kind(std::size_t idx) const;
+    protos::MemoryKind memory_kind(std::size_t idx) const;
+
+    /**
+     * @brief instance_id of a Remote descriptor or buffer_id of a Packed descriptor
+     */
+    std::uint32_t id(std::size_t idx) const;
+
+    /**
+     * @brief object_id of a Remote descriptor
+     */
+    std::uint32_t object_id(std::size_t idx) const;
+
+    /**
+     * @brief remote address of a Remote or Packed descriptor
+     */
+    std::uint64_t remote_address(std::size_t idx) const;
+
+    /**
+     * @brief remote bytes of a Remote or Packed descriptor
+     */
+    std::uint64_t remote_bytes(std::size_t idx) const;
+
+    /**
+     * @brief payload of an Eager descriptor, remote key of a Remote descriptor or serialized Any of a MetaData
+     * descriptor
+     */
+    std::string_view data(std::size_t idx) const;
+
+    /**
+     * @brief id of the Compressor applied to a Remote or Eager descriptor; 0 if uncompressed
+     */
+    std::uint32_t compression(std::size_t idx) const;
+
+    /**
+     * @brief size of the block of a compressed Remote or Eager descriptor after decompression
+     */
+    std::uint64_t uncompressed_bytes(std::size_t idx) const;
+
+  private:
+    const std::byte* descriptor(std::size_t idx) const;
+
+    const std::byte* m_data;
+    std::size_t m_bytes;
+    std::size_t m_descriptor_count;
+    std::size_t m_object_count;
+};
+
+}  // namespace srf::codable::flat
@@ -23,6 +23,7 @@
 #include <srf/memory/block.hpp>
 #include <srf/memory/memory_kind.hpp>
 
+#include <cstring>
 #include <type_traits>
 #include <typeindex>
 
@@ -40,9 +41,11 @@ struct codable_protocol<T, std::enable_if_t<std::is_fundamental_v<T>>>
     static T deserialize(const EncodedObject& encoded, std::size_t object_idx)
     {
         DCHECK_EQ(std::type_index(typeid(T)).hash_code(), encoded.type_index_hash_for_object(object_idx));
-        auto idx          = encoded.start_idx_for_object(object_idx);
-        const auto& eager = encoded.eager_descriptor(idx);
-        T val             = *(reinterpret_cast<const T*>(eager.data().data()));
+        auto idx   = encoded.start_idx_for_object(object_idx);
+        auto block = encoded.memory_block(idx);
+        DCHECK_EQ(block.bytes(), sizeof(T));
+        T val;
+        std::memcpy(&val, block.data(), sizeof(T));
         return val;
     }
 };
@@ -55,14 +58,14 @@ struct codable_protocol<T, std::enable_if_t<std::is_same_v<T, std::string>>>
         auto guard = encoded.acquire_encoding_context();
         if (opts.force_copy())
         {
-            auto index = encoded.add_host_buffer(str.size());
+            auto index = encoded.add_payload_buffer(str.size());
             auto block = encoded.mutable_memory_block(index);
             std::memcpy(block.data(), str.data(), str.size());
         }
         else
         {
             // not registered
-            encoded.add_memory_block(memory::const_block(str.data(), str.size(), memory::memory_kind_type::host));
+            encoded.add_host_block(memory::const_block(str.data(), str.size(), memory::memory_kind_type::host));
         }
     }
 
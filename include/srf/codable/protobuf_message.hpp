@@ -35,7 +35,7 @@ struct codable_protocol<T, std::enable_if_t<std::is_base_of_v<::google::protobuf
     static void serialize(const T& msg, Encoded<T>& encoded, const EncodingOptions& opts)
     {
         auto guard = encoded.acquire_encoding_context();
-        auto index = encoded.add_host_buffer(msg.ByteSizeLong());
+        auto index = encoded.add_payload_buffer(msg.ByteSizeLong());
         auto block = encoded.mutable_memory_block(index);
         msg.SerializeToArray(block.data(), block.bytes());
     }
@@ -19,7 +19,10 @@
 
 #define SRF_DEFAULT_BUFFERED_CHANNEL_SIZE 128
 #define SRF_DEFAULT_FIBER_PRIORITY 0
+#define SRF_MIN_FIBER_PRIORITY -32
+#define SRF_MAX_FIBER_PRIORITY 31
 #define SRF_MAX_EAGER_BUFFER_SIZE 128
+#define SRF_RETIRE_POLL_PERIOD_MS 50
 
 #define PORT_ID_MAX UINT16_MAX
 #define SEGMENT_ID_MAX UINT16_MAX
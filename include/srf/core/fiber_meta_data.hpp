@@ -19,6 +19,8 @@
 
 #include <srf/constants.hpp>
 
+#include <chrono>
+
 namespace srf {
 
 /**
@@ -27,6 +29,10 @@ namespace srf {
 struct FiberMetaData
 {
     int priority{SRF_DEFAULT_FIBER_PRIORITY};
+
+    // relative deadline; each time the fiber becomes ready it is due at now + deadline. zero means no deadline.
+    // only honored when the fiber pool is configured with FiberPoolOptions::enable_deadline_scheduling
+    std::chrono::nanoseconds deadline{std::chrono::nanoseconds::zero()};
 };
 
 }  // namespace srf
@@ -24,17 +24,175 @@
 #include <boost/fiber/all.hpp>
 #include <boost/fiber/future/future.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <stdexcept>
 #include <thread>
+#include <type_traits>
+#include <utility>
 
 namespace srf::core {
 
-class FiberTaskQueue
+/**
+ * @brief Unit of work submitted to a FiberTaskQueue
+ *
+ * Tasks are intrusive nodes of the queue's submission list, so submitting a task requires no allocation beyond the
+ * task itself.
+ */
+class FiberTask
 {
-  protected:
-    using task_t     = boost::fibers::packaged_task<void()>;
-    using task_pkg_t = std::pair<task_t, FiberMetaData>;
+  public:
+    FiberTask() = default;
+    FiberTask(FiberMetaData meta_data) : m_meta_data(std::move(meta_data)) {}
+    virtual ~FiberTask() = default;
+
+    virtual void run() = 0;
+
+    const FiberMetaData& meta_data() const
+    {
+        return m_meta_data;
+    }
+
+  private:
+    FiberMetaData m_meta_data;
+    std::atomic<FiberTask*> m_next{nullptr};
 
+    friend class FiberTaskList;
+};
+
+/**
+ * @brief FiberTask which invokes a callable
+ */
+template <typename F>
+class CallableFiberTask final : public FiberTask
+{
+  public:
+    CallableFiberTask(FiberMetaData meta_data, F&& f) : FiberTask(std::move(meta_data)), m_callable(std::move(f)) {}
+
+    void run() final
+    {
+        m_callable();
+    }
+
+  private:
+    F m_callable;
+};
+
+template <typename F>
+std::unique_ptr<FiberTask> make_fiber_task(FiberMetaData meta_data, F&& f)
+{
+    return std::make_unique<CallableFiberTask<std::decay_t<F>>>(std::move(meta_data), std::decay_t<F>(std::forward<F>(f)));
+}
+
+/**
+ * @brief Lock-free intrusive multi-producer, single-consumer list of FiberTasks
+ *
+ * Any number of threads may push; only the thread owning the queue may pop. A push is a single atomic exchange
+ * regardless of how many pre-linked tasks are pushed. pop() may transiently report empty while a concurrent push is
+ * being linked; the pusher is always able to observe that the consumer went idle afterwards.
+ */
+class FiberTaskList final
+{
+  public:
+    FiberTaskList() : m_head(&m_stub), m_tail(&m_stub) {}
+
+    ~FiberTaskList()
+    {
+        while (auto* task = pop())
+        {
+            delete task;
+        }
+    }
+
+    FiberTaskList(const FiberTaskList&) = delete;
+    FiberTaskList& operator=(const FiberTaskList&) = delete;
+
+    /**
+     * @brief link the chain first -> ... -> last, which must already be linked via link(), onto the list
+     */
+    void push(FiberTask* first, FiberTask* last)
+    {
+        last->m_next.store(nullptr, std::memory_order_relaxed);
+        auto* prev = m_head.exchange(last, std::memory_order_acq_rel);
+        prev->m_next.store(first, std::memory_order_release);
+    }
+
+    void push(FiberTask* task)
+    {
+        push(task, task);
+    }
+
+    static void link(FiberTask* prev, FiberTask* next)
+    {
+        prev->m_next.store(next, std::memory_order_relaxed);
+    }
+
+    static FiberTask* linked(FiberTask* task)
+    {
+        return task->m_next.load(std::memory_order_relaxed);
+    }
+
+    FiberTask* pop()
+    {
+        auto* tail = m_tail;
+        auto* next = tail->m_next.load(std::memory_order_acquire);
+
+        if (tail == &m_stub)
+        {
+            if (next == nullptr)
+            {
+                return nullptr;
+            }
+            m_tail = next;
+            tail   = next;
+            next   = next->m_next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        if (tail != m_head.load(std::memory_order_acquire))
+        {
+            // a producer has swapped the head but not yet linked its task
+            return nullptr;
+        }
+
+        // tail is the last task; re-insert the stub behind it so tail can be handed out
+        push(&m_stub);
+        next = tail->m_next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+  private:
+    class Stub final : public FiberTask
+    {
+        void run() final {}
+    };
+
+    Stub m_stub;
+    std::atomic<FiberTask*> m_head;
+    FiberTask* m_tail;
+};
+
+/**
+ * @brief Queue of tasks, each of which is launched as a detached fiber on the queue's thread
+ *
+ * Submission is unbounded: enqueue never blocks the producer, and tasks are launched as fibers as soon as the queue's
+ * main fiber runs. Producers which need backpressure must bound their own in-flight work, e.g. by waiting on the
+ * futures returned by enqueue.
+ */
+class FiberTaskQueue
+{
   public:
     virtual ~FiberTaskQueue() = default;
 
@@ -57,34 +215,56 @@ class FiberTaskQueue
     auto enqueue(FiberMetaData&& meta_data, F&& f, ArgsT&&... args)
         -> Future<typename std::result_of<F(ArgsT...)>::type>
     {
-        if (task_queue().is_closed())
-        {
-            throw std::runtime_error("enqueue on stopped ws fiber pool");
-        }
-
         using namespace boost::fibers;
         using return_type_t = typename std::result_of<F(ArgsT...)>::type;
 
         packaged_task<return_type_t()> task(std::bind(std::forward<F>(f), std::forward<ArgsT>(args)...));
         future<return_type_t> future = task.get_future();
 
-        // track detached fibers - main fiber will wait on all detached fibers to finish
-        packaged_task<void()> wrapped_task([this, t = std::move(task)]() mutable {
-            t();
-            --m_detached;
-        });
-        ++m_detached;
-
-        // package the wrapped task and meta data as a tuple and push to the buffered channel
-        auto task_package = std::make_pair(std::move(wrapped_task), std::move(meta_data));
-
-        // push the task package to the buffered channel
-        task_queue().push(std::move(task_package));
+        submit(make_fiber_task(std::move(meta_data), [t = std::move(task)]() mutable { t(); }));
 
         // return future
         return future;
     }
 
+    /**
+     * @brief Fire-and-forget submission; no future or shared state is allocated
+     *
+     * Exceptions escaping f terminate the process, as they would for any detached fiber.
+     */
+    template <class F>
+    void enqueue_detached(F&& f)
+    {
+        enqueue_detached(FiberMetaData{}, std::forward<F>(f));
+    }
+
+    template <class F>
+    void enqueue_detached(FiberMetaData meta_data, F&& f)
+    {
+        submit(make_fiber_task(std::move(meta_data), std::forward<F>(f)));
+    }
+
+    /**
+     * @brief Fire-and-forget submission of every callable in [begin, end) with a single atomic push
+     *
+     * If constructing any task throws, the tasks already built are destroyed and none are submitted.
+     */
+    template <typename IteratorT>
+    void enqueue_detached_batch(const FiberMetaData& meta_data, IteratorT begin, IteratorT end)
+    {
+        TaskChain chain;
+
+        for (auto it = begin; it != end; ++it)
+        {
+            chain.append(make_fiber_task(meta_data, std::move(*it)).release());
+        }
+
+        if (chain.first != nullptr)
+        {
+            submit(chain);
+        }
+    }
+
     virtual const CpuSet& affinity() const = 0;
 
   protected:
@@ -93,8 +273,81 @@ class FiberTaskQueue
         return m_detached.load();
     }
 
+    /**
+     * @brief invoked by the owner of the queue when a submitted task has completed
+     */
+    void task_completed()
+    {
+        --m_detached;
+    }
+
   private:
-    virtual boost::fibers::buffered_channel<task_pkg_t>& task_queue() = 0;
+    /**
+     * @brief Owning chain of linked tasks which have not yet been handed to push_tasks
+     */
+    struct TaskChain
+    {
+        TaskChain() = default;
+        TaskChain(const TaskChain&) = delete;
+        TaskChain& operator=(const TaskChain&) = delete;
+
+        ~TaskChain()
+        {
+            for (auto* task = first; task != nullptr;)
+            {
+                auto* next = (task == last) ? nullptr : FiberTaskList::linked(task);
+                delete task;
+                task = next;
+            }
+        }
+
+        void append(FiberTask* task)
+        {
+            if (first == nullptr)
+            {
+                first = task;
+            }
+            else
+            {
+                FiberTaskList::link(last, task);
+            }
+            last = task;
+            ++count;
+        }
+
+        FiberTask* first{nullptr};
+        FiberTask* last{nullptr};
+        std::size_t count{0};
+    };
+
+    void submit(std::unique_ptr<FiberTask> task)
+    {
+        TaskChain chain;
+        chain.append(task.release());
+        submit(chain);
+    }
+
+    void submit(TaskChain& chain)
+    {
+        // track detached fibers - main fiber will wait on all detached fibers to finish
+        m_detached += chain.count;
+        if (!push_tasks(chain.first, chain.last))
+        {
+            m_detached -= chain.count;
+            throw std::runtime_error("enqueue on stopped ws fiber pool");
+        }
+
+        // ownership of the tasks has passed to the queue
+        chain.first = nullptr;
+        chain.last  = nullptr;
+        chain.count = 0;
+    }
+
+    /**
+     * @brief push the linked chain of tasks first -> ... -> last; returns false without taking ownership if the queue
+     * has been shut down
+     */
+    virtual bool push_tasks(FiberTask* first, FiberTask* last) = 0;
 
     std::atomic<std::size_t> m_detached{0};
 };
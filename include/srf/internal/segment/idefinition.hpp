@@ -35,6 +35,10 @@ namespace srf::internal::pipeline {
 class IPipeline;
 }
 
+namespace srf::protos {
+class SegmentOptions;
+}
+
 namespace srf::internal::segment {
 
 class Definition;
@@ -55,6 +59,16 @@ struct IDefinition
 
     const std::string& name() const;
 
+    /**
+     * @brief Placement and scaling options applied to the instances of this segment
+     *
+     * Must be set before the pipeline is started.
+     *
+     * @throws exceptions::SrfRuntimeError if the Dynamic scaling strategy is requested with max_count less than
+     * max(min_count, 1) or a scale_down_utilization greater than 1
+     */
+    void set_options(const protos::SegmentOptions& options);
+
     // const SegmentID& id() const;
     // std::vector<std::string> ingress_port_names() const;
     // std::vector<std::string> egress_port_names() const;
@@ -64,6 +64,12 @@ class CompositeManifold : public Manifold
         return *m_egress;
     }
 
+    const EgressT& egress() const
+    {
+        CHECK(m_egress);
+        return *m_egress;
+    }
+
   private:
     void do_add_input(const SegmentAddress& address, node::SourcePropertiesBase* input_source) final
     {
@@ -85,6 +91,15 @@ class CompositeManifold : public Manifold
         });
     }
 
+    void do_drop_output(const SegmentAddress& address) final
+    {
+        // enqueue update to be done later
+        m_output_updates.push_back([this, address] {
+            DVLOG(10) << info() << ": egress detaching from downstream segment " << segment::info(address);
+            m_egress->drop_output(address);
+        });
+    }
+
     void update(std::vector<std::function<void()>>& updates)
     {
         resources()
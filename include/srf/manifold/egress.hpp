@@ -23,7 +23,15 @@
 #include "srf/node/sink_properties.hpp"
 #include "srf/node/source_properties.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace srf::manifold {
 
@@ -31,6 +39,7 @@ struct EgressDelegate
 {
     virtual ~EgressDelegate()                                                                     = default;
     virtual void add_output(const SegmentAddress& address, node::SinkPropertiesBase* output_sink) = 0;
+    virtual void drop_output(const SegmentAddress& address)                                       = 0;
 };
 
 template <typename T>
@@ -48,39 +57,61 @@ class TypedEngress : public EgressDelegate
     virtual void do_add_output(const SegmentAddress& address, node::SinkProperties<T>& output_sink) = 0;
 };
 
+/**
+ * @brief Egress which owns one output channel per downstream SegmentAddress.
+ *
+ * Output channels are held by shared_ptr so a writer which yields inside await_write keeps its output alive if the
+ * output is dropped concurrently; the downstream channel is released after the last in-flight write completes.
+ */
 template <typename T>
 class MappedEgress : public TypedEngress<T>
 {
   public:
-    using channel_map_t = std::unordered_map<SegmentAddress, std::unique_ptr<node::SourceChannelWriteable<T>>>;
+    using output_t      = node::SourceChannelWriteable<T>;
+    using channel_map_t = std::unordered_map<SegmentAddress, std::shared_ptr<output_t>>;
 
     const channel_map_t& output_channels() const
     {
         return m_outputs;
     }
 
+    void drop_output(const SegmentAddress& address) final
+    {
+        auto search = m_outputs.find(address);
+        CHECK(search != m_outputs.end());
+        m_outputs.erase(search);
+        on_outputs_updated();
+    }
+
     void clear()
     {
         m_outputs.clear();
+        on_outputs_updated();
     }
 
   protected:
-    void do_add_output(const SegmentAddress& address, node::SinkProperties<T>& sink) override
+    void do_add_output(const SegmentAddress& address, node::SinkProperties<T>& sink) final
     {
         auto search = m_outputs.find(address);
         CHECK(search == m_outputs.end());
-        auto output_channel = std::make_unique<node::SourceChannelWriteable<T>>();
+        auto output_channel = std::make_shared<output_t>();
         node::make_edge(*output_channel, sink);
         m_outputs[address] = std::move(output_channel);
+        on_outputs_updated();
     }
 
   private:
-    std::unordered_map<SegmentAddress, std::unique_ptr<node::SourceChannelWriteable<T>>> m_outputs;
+    // hook for derived classes to rebuild any state derived from output_channels
+    virtual void on_outputs_updated() {}
+
+    channel_map_t m_outputs;
 };
 
 template <typename T>
 class RoundRobinEgress : public MappedEgress<T>
 {
+    using output_t = typename MappedEgress<T>::output_t;
+
   public:
     // todo(#189) - use raw_checks for hot path
     void await_write(T&& data)
@@ -92,30 +123,290 @@ class RoundRobinEgress : public MappedEgress<T>
         {
             m_next = 0;
         }
-        CHECK(m_pick_list[next]->await_write(std::move(data)) == channel::Status::success);
+        // hold a reference to the output in case it is dropped while this write yields
+        auto output = m_pick_list[next];
+        CHECK(output->await_write(std::move(data)) == channel::Status::success);
     }
 
   private:
-    void do_add_output(const SegmentAddress& address, node::SinkProperties<T>& sink) override
-    {
-        MappedEgress<T>::do_add_output(address, sink);
-        update_pick_list();
-    }
-
-    void update_pick_list()
+    void on_outputs_updated() final
     {
         m_pick_list.clear();
         m_pick_list.reserve(this->output_channels().size());
         for (const auto& [rank, channel] : this->output_channels())
         {
-            m_pick_list.push_back(channel.get());
+            m_pick_list.push_back(channel);
         }
         std::random_shuffle(m_pick_list.begin(), m_pick_list.end());
         m_next = 0;
     }
 
     std::size_t m_next{0};
-    std::vector<node::SourceChannelWriteable<T>*> m_pick_list;
+    std::vector<std::shared_ptr<output_t>> m_pick_list;
+};
+
+/**
+ * @brief Round-robin egress which prefers downstream segments on the same host partition (numa domain) as the
+ * producer of each object.
+ *
+ * Producers write through a Writer created for their host partition. Each write is first offered, without yielding, to
+ * the outputs local to the producer in round-robin order. Remote outputs are only offered the data when every local
+ * output is full. If all outputs are full, the writer applies backpressure by awaiting on the next local output, or the
+ * next remote output if the producer has no local outputs.
+ *
+ * An output whose path does not support try_write can not report that it is full. A local output of that kind is
+ * written with a yielding await_write once the try-writable local outputs are full, so data never spills past it;
+ * remote outputs of that kind only receive data through the backpressure path.
+ *
+ * Outputs are added and dropped on the manifold's task queue while writers run on the engines of their producers.
+ * Writers read an immutable snapshot of the outputs which is republished on every update, and only hold it for the
+ * duration of a write, so a dropped output is released once its in-flight writes complete.
+ */
+template <typename T>
+class LocalityAwareEgress : public MappedEgress<T>
+{
+    using output_t = typename MappedEgress<T>::output_t;
+
+  public:
+    using host_partition_t    = std::optional<std::size_t>;
+    using host_partition_fn_t = std::function<host_partition_t(const SegmentAddress&)>;
+
+    class Writer;
+
+    LocalityAwareEgress() : m_routes(std::make_shared<const routes_t>()) {}
+
+    /**
+     * @brief Set the function which maps an output's SegmentAddress to its host partition; outputs without a host
+     * partition are local to every producer.
+     */
+    void set_host_partitions(host_partition_fn_t host_partition)
+    {
+        m_host_partition = std::move(host_partition);
+        on_outputs_updated();
+    }
+
+    /**
+     * @brief Create a writer for a producer running on host_partition; a producer without a host partition treats
+     * every output as local.
+     */
+    Writer make_writer(host_partition_t host_partition)
+    {
+        return Writer(*this, host_partition);
+    }
+
+    std::size_t local_writes() const
+    {
+        return m_local_writes.load(std::memory_order_relaxed);
+    }
+
+    std::size_t remote_writes() const
+    {
+        return m_remote_writes.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of writes which found every output full and had to apply backpressure
+     */
+    std::size_t blocked_writes() const
+    {
+        return m_blocked_writes.load(std::memory_order_relaxed);
+    }
+
+    std::size_t output_count() const
+    {
+        return m_output_count.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Route
+    {
+        host_partition_t host_partition;
+        bool supports_try_write;
+        std::shared_ptr<output_t> output;
+    };
+    using routes_t = std::vector<Route>;
+
+    void on_outputs_updated() final
+    {
+        auto routes = std::make_shared<routes_t>();
+        routes->reserve(this->output_channels().size());
+        for (const auto& [address, channel] : this->output_channels())
+        {
+            host_partition_t host_partition;
+            if (m_host_partition)
+            {
+                host_partition = m_host_partition(address);
+            }
+            routes->push_back(Route{host_partition, channel->supports_try_write(), channel});
+        }
+        std::random_shuffle(routes->begin(), routes->end());
+
+        std::atomic_store(&m_routes, std::shared_ptr<const routes_t>(std::move(routes)));
+        m_version.fetch_add(1, std::memory_order_release);
+        m_output_count.store(this->output_channels().size(), std::memory_order_relaxed);
+    }
+
+    host_partition_fn_t m_host_partition{nullptr};
+    std::shared_ptr<const routes_t> m_routes;  // accessed with std::atomic_load/std::atomic_store
+    std::atomic<std::uint64_t> m_version{0};
+    std::atomic<std::size_t> m_local_writes{0};
+    std::atomic<std::size_t> m_remote_writes{0};
+    std::atomic<std::size_t> m_blocked_writes{0};
+    std::atomic<std::size_t> m_output_count{0};
+};
+
+/**
+ * @brief Per-producer writer of a LocalityAwareEgress
+ *
+ * A Writer may be shared by the fibers of a single thread, but not across threads; create one writer per producer.
+ */
+template <typename T>
+class LocalityAwareEgress<T>::Writer
+{
+  public:
+    // todo(#189) - use raw_checks for hot path
+    void await_write(T&& data)
+    {
+        // holding the snapshot keeps every output alive for the duration of this write, even if it yields
+        auto routes = current_routes();
+
+        if (try_write(m_local, data))
+        {
+            m_egress->m_local_writes.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // local outputs which can not report that they are full take the data before it may spill
+        if (!m_local_blocking.outputs.empty())
+        {
+            auto* output = m_local_blocking.next();
+            m_egress->m_local_writes.fetch_add(1, std::memory_order_relaxed);
+            CHECK(output->await_write(std::move(data)) == channel::Status::success);
+            return;
+        }
+
+        if (try_write(m_remote, data))
+        {
+            m_egress->m_remote_writes.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // every output is full - block on the preferred output
+        bool use_local  = !m_all_local.outputs.empty();
+        auto& pick_list = use_local ? m_all_local : m_all_remote;
+        CHECK(!pick_list.outputs.empty());
+
+        auto* output = pick_list.next();
+        (use_local ? m_egress->m_local_writes : m_egress->m_remote_writes).fetch_add(1, std::memory_order_relaxed);
+        m_egress->m_blocked_writes.fetch_add(1, std::memory_order_relaxed);
+        CHECK(output->await_write(std::move(data)) == channel::Status::success);
+    }
+
+    /**
+     * @brief Forget the current snapshot of outputs; called when the producer completes
+     */
+    void release()
+    {
+        m_routes.reset();
+        m_version = no_version;
+        release_lists();
+    }
+
+  private:
+    Writer(LocalityAwareEgress& egress, host_partition_t host_partition) :
+      m_egress(&egress),
+      m_host_partition(host_partition)
+    {}
+
+    struct PickList
+    {
+        std::vector<output_t*> outputs;
+        std::size_t next_index{0};
+
+        // returns the current output and rolls the counter; roll before any write which could yield
+        output_t* next()
+        {
+            auto* output = outputs[next_index++];
+            if (next_index >= outputs.size())
+            {
+                next_index = 0;
+            }
+            return output;
+        }
+    };
+
+    static constexpr std::uint64_t no_version = std::numeric_limits<std::uint64_t>::max();
+
+    std::shared_ptr<const routes_t> current_routes()
+    {
+        auto version = m_egress->m_version.load(std::memory_order_acquire);
+        auto routes  = m_routes.lock();
+        if (routes && version == m_version)
+        {
+            return routes;
+        }
+
+        routes    = std::atomic_load(&m_egress->m_routes);
+        m_routes  = routes;
+        m_version = version;
+
+        release_lists();
+        for (const auto& route : *routes)
+        {
+            bool local = !m_host_partition || !route.host_partition || *route.host_partition == *m_host_partition;
+            auto* output = route.output.get();
+            if (local)
+            {
+                (route.supports_try_write ? m_local : m_local_blocking).outputs.push_back(output);
+                m_all_local.outputs.push_back(output);
+            }
+            else
+            {
+                if (route.supports_try_write)
+                {
+                    m_remote.outputs.push_back(output);
+                }
+                m_all_remote.outputs.push_back(output);
+            }
+        }
+        return routes;
+    }
+
+    void release_lists()
+    {
+        for (auto* pick_list : {&m_local, &m_local_blocking, &m_remote, &m_all_local, &m_all_remote})
+        {
+            pick_list->outputs.clear();
+            pick_list->next_index = 0;
+        }
+    }
+
+    // offer data to each output in the pick list once without yielding; data is only consumed on success
+    static bool try_write(PickList& pick_list, T& data)
+    {
+        for (std::size_t i = 0; i < pick_list.outputs.size(); ++i)
+        {
+            auto rc = pick_list.next()->try_write(std::move(data));
+            if (rc == channel::Status::success)
+            {
+                return true;
+            }
+            CHECK(rc == channel::Status::full);
+        }
+        return false;
+    }
+
+    LocalityAwareEgress* m_egress;
+    host_partition_t m_host_partition;
+    std::weak_ptr<const routes_t> m_routes;
+    std::uint64_t m_version{no_version};
+    PickList m_local;           // try-writable outputs local to the producer
+    PickList m_local_blocking;  // local outputs which can not report that they are full
+    PickList m_remote;          // try-writable remote outputs
+    PickList m_all_local;
+    PickList m_all_remote;
+
+    friend LocalityAwareEgress;
 };
 
 }  // namespace srf::manifold
@@ -23,7 +23,9 @@
 #include "srf/node/sink_properties.hpp"
 #include "srf/node/source_properties.hpp"
 
+#include <functional>
 #include <memory>
+#include <utility>
 
 namespace srf::manifold {
 
@@ -78,4 +80,31 @@ class MuxedIngress : public TypedIngress<T>
     std::shared_ptr<node::Muxer<T>> m_muxer;
 };
 
+/**
+ * @brief Ingress which hands each upstream source to a handler instead of muxing them, so the manifold can process the
+ * data of each producer with knowledge of where that producer runs.
+ */
+template <typename T>
+class PerInputIngress : public IngressDelegate
+{
+  public:
+    using handler_t = std::function<void(const SegmentAddress&, node::SourceProperties<T>&)>;
+
+    void set_handler(handler_t handler)
+    {
+        m_handler = std::move(handler);
+    }
+
+    void add_input(const SegmentAddress& address, node::SourcePropertiesBase* input_source) final
+    {
+        auto source = dynamic_cast<node::SourceProperties<T>*>(input_source);
+        CHECK(source);
+        CHECK(m_handler);
+        m_handler(address, *source);
+    }
+
+  private:
+    handler_t m_handler;
+};
+
 }  // namespace srf::manifold
@@ -20,8 +20,33 @@
 #include <srf/node/forward.hpp>
 #include <srf/types.hpp>
 
+#include <cstddef>
+
+namespace srf::pipeline {
+struct Resources;
+}  // namespace srf::pipeline
+
 namespace srf::manifold {
 
+/**
+ * @brief Cumulative counters describing the hand-off from a manifold to its downstream segments
+ */
+struct EgressStatistics
+{
+    // total number of objects handed to downstream segments
+    std::size_t writes{0};
+
+    // number of hand-offs which found every downstream channel full and applied backpressure
+    std::size_t blocked_writes{0};
+
+    // number of attached downstream segments
+    std::size_t outputs{0};
+
+    // hand-offs to a downstream segment on the same host partition as the producer, and to any other segment
+    std::size_t local_writes{0};
+    std::size_t remote_writes{0};
+};
+
 struct Interface
 {
     virtual ~Interface()                                                                            = default;
@@ -31,6 +56,12 @@ struct Interface
     virtual void add_input(const SegmentAddress& address, node::SourcePropertiesBase* input_source) = 0;
     virtual void add_output(const SegmentAddress& address, node::SinkPropertiesBase* output_sink)   = 0;
 
+    // detach a downstream segment; the segment's input is released once in-flight writes complete
+    virtual void drop_output(const SegmentAddress& address) = 0;
+
+    // locality hint - the resources of the host partition (numa domain) on which the segment at address is running
+    virtual void set_segment_resources(const SegmentAddress& address, pipeline::Resources& resources) = 0;
+
     // updates are ordered
     // first, inputs are updated (upstream segments have not started emitting - this is safe)
     // then, upstream segments are started,
@@ -38,6 +69,8 @@ struct Interface
     // this ensures downstream segments have started and are immediately capaable of handling data
     virtual void update_inputs()  = 0;
     virtual void update_outputs() = 0;
+
+    virtual EgressStatistics egress_statistics() const = 0;
 };
 
 }  // namespace srf::manifold
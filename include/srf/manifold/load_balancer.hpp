@@ -23,7 +23,6 @@
 #include "srf/manifold/composite_manifold.hpp"
 #include "srf/node/edge_builder.hpp"
 #include "srf/node/generic_sink.hpp"
-#include "srf/node/operators/muxer.hpp"
 #include "srf/node/rx_sink.hpp"
 #include "srf/node/source_channel.hpp"
 #include "srf/pipeline/resources.hpp"
@@ -32,8 +31,14 @@
 #include "srf/runnable/types.hpp"
 #include "srf/types.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 namespace srf::manifold {
 
@@ -43,30 +48,43 @@ template <typename T>
 class Balancer : public node::GenericSink<T>
 {
   public:
-    Balancer(RoundRobinEgress<T>& state) : m_state(state) {}
+    using writer_t = typename LocalityAwareEgress<T>::Writer;
+
+    Balancer(writer_t writer, std::function<void()> on_complete) :
+      m_writer(std::move(writer)),
+      m_on_complete(std::move(on_complete))
+    {}
 
   private:
     void on_data(T&& data) final
     {
-        // LOG(INFO) << "balancer node: " << data;
-        m_state.await_write(std::move(data));
+        m_writer.await_write(std::move(data));
     }
 
     void will_complete() final
     {
-        DVLOG(10) << "shutdown load-balancer - clear output channels";
-        m_state.clear();
+        DVLOG(10) << "shutdown load-balancer for producer";
+        m_writer.release();
+        m_on_complete();
     };
 
-    RoundRobinEgress<T>& m_state;
+    writer_t m_writer;
+    std::function<void()> m_on_complete;
 };
 
 }  // namespace detail
 
+/**
+ * @brief Manifold which distributes the data of its upstream segments over its downstream segments
+ *
+ * Each upstream segment is drained by its own balancer, launched on the host partition of that segment, which prefers
+ * downstream segments on the same host partition; see LocalityAwareEgress. The downstream channels are released after
+ * the last balancer completes.
+ */
 template <typename T>
-class LoadBalancer : public CompositeManifold<MuxedIngress<T>, RoundRobinEgress<T>>
+class LoadBalancer : public CompositeManifold<PerInputIngress<T>, LocalityAwareEgress<T>>
 {
-    using base_t = CompositeManifold<MuxedIngress<T>, RoundRobinEgress<T>>;
+    using base_t = CompositeManifold<PerInputIngress<T>, LocalityAwareEgress<T>>;
 
   public:
     LoadBalancer(PortName port_name, pipeline::Resources& resources) : base_t(std::move(port_name), resources)
@@ -79,36 +97,44 @@ class LoadBalancer : public CompositeManifold<MuxedIngress<T>, RoundRobinEgress<
         this->resources()
             .main()
             .enqueue([this] {
-                m_balancer = std::make_unique<detail::Balancer<T>>(this->egress());
-                node::make_edge(this->ingress().source(), *m_balancer);
+                this->egress().set_host_partitions(
+                    [this](const SegmentAddress& address) { return this->host_partition(address); });
+                this->ingress().set_handler([this](const SegmentAddress& address, node::SourceProperties<T>& source) {
+                    add_balancer(address, source);
+                });
             })
             .get();
     }
 
     void start() final
     {
-        this->resources()
-            .main()
-            .enqueue([this] {
-                if (m_runner)
-                {
-                    // todo(#179) - validate this fix and improve test coverage
-                    // this will be handled now by the default behavior of SourceChannel::no_channel method
-                    // CHECK(!this->egress().output_channels().empty()) << "no egress channels on manifold";
-                    return;
-                }
-                CHECK(m_balancer);
-                m_runner = this->resources()
-                               .launch_control()
-                               .prepare_launcher(launch_options(), std::move(m_balancer))
-                               ->ignition();
-            })
-            .get();
+        std::map<SegmentAddress, std::unique_ptr<node::GenericSink<T>>> pending;
+        {
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            m_started = true;
+            pending   = std::move(m_pending);
+            m_pending.clear();
+        }
+        for (auto& [address, balancer] : pending)
+        {
+            launch(address, std::move(balancer));
+        }
     }
 
     void join() final
     {
-        m_runner->await_join();
+        std::vector<runnable::Runner*> runners;
+        {
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            for (auto& [address, runner] : m_runners)
+            {
+                runners.push_back(runner.get());
+            }
+        }
+        for (auto* runner : runners)
+        {
+            runner->await_join();
+        }
     }
 
     const runnable::LaunchOptions& launch_options() const
@@ -116,15 +142,79 @@ class LoadBalancer : public CompositeManifold<MuxedIngress<T>, RoundRobinEgress<
         return m_launch_options;
     }
 
+    EgressStatistics egress_statistics() const final
+    {
+        EgressStatistics stats;
+        const auto& egress   = this->egress();
+        stats.local_writes   = egress.local_writes();
+        stats.remote_writes  = egress.remote_writes();
+        stats.writes         = stats.local_writes + stats.remote_writes;
+        stats.blocked_writes = egress.blocked_writes();
+        stats.outputs        = egress.output_count();
+        return stats;
+    }
+
   private:
+    // called on the manifold's task queue when an upstream segment is attached
+    void add_balancer(const SegmentAddress& address, node::SourceProperties<T>& source)
+    {
+        m_active_balancers.fetch_add(1, std::memory_order_relaxed);
+        auto balancer = std::make_unique<detail::Balancer<T>>(
+            this->egress().make_writer(this->host_partition(address)), [this] { on_balancer_complete(); });
+        node::make_edge(source, *balancer);
+
+        {
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            if (!m_started)
+            {
+                m_pending[address] = std::move(balancer);
+                return;
+            }
+        }
+        launch(address, std::move(balancer));
+    }
+
+    // the balancer of an upstream segment runs on the host partition of that segment
+    void launch(const SegmentAddress& address, std::unique_ptr<node::GenericSink<T>> balancer)
+    {
+        auto& resources = this->resources(address);
+        std::unique_ptr<runnable::Runner> runner;
+        resources.main()
+            .enqueue([this, &resources, &runner, &balancer] {
+                runner =
+                    resources.launch_control().prepare_launcher(launch_options(), std::move(balancer))->ignition();
+            })
+            .get();
+
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        CHECK(m_runners.find(address) == m_runners.end());
+        m_runners[address] = std::move(runner);
+    }
+
+    // called by each balancer as it completes, on the engine of its upstream segment
+    void on_balancer_complete()
+    {
+        if (m_active_balancers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            DVLOG(10) << "shutdown load-balancer - clear output channels";
+
+            // the outputs are owned by the manifold's task queue
+            this->resources().main().enqueue([this] { this->egress().clear(); }).get();
+        }
+    }
+
     // launch options
     runnable::LaunchOptions m_launch_options;
 
-    // this is the progress engine that will drive the load balancer
-    std::unique_ptr<node::GenericSink<T>> m_balancer;
+    // balancers of upstream segments which are launched when the manifold starts
+    std::map<SegmentAddress, std::unique_ptr<node::GenericSink<T>>> m_pending;
+
+    // runners of the balancers of each upstream segment
+    std::map<SegmentAddress, std::unique_ptr<runnable::Runner>> m_runners;
 
-    // runner
-    std::unique_ptr<runnable::Runner> m_runner{nullptr};
+    std::atomic<std::size_t> m_active_balancers{0};
+    bool m_started{false};
+    std::mutex m_mutex;
 };
 
 }  // namespace srf::manifold
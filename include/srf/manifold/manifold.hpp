@@ -23,7 +23,11 @@
 #include <srf/pipeline/resources.hpp>
 #include <srf/types.hpp>
 
+#include <cstddef>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 
 namespace srf::manifold {
 
@@ -34,9 +38,27 @@ class Manifold : public Interface
 
     const PortName& port_name() const final;
 
+    void set_segment_resources(const SegmentAddress& address, pipeline::Resources& resources) final;
+
+    EgressStatistics egress_statistics() const override
+    {
+        return {};
+    }
+
   protected:
     pipeline::Resources& resources();
 
+    /**
+     * @brief Resources of the host partition on which the segment at address runs; the manifold's own resources if the
+     * segment has no locality hint
+     */
+    pipeline::Resources& resources(const SegmentAddress& address);
+
+    /**
+     * @brief Host partition on which the segment at address runs, if known
+     */
+    std::optional<std::size_t> host_partition(const SegmentAddress& address) const;
+
     const std::string& info() const
     {
         return m_info;
@@ -47,12 +69,17 @@ class Manifold : public Interface
 
     void add_output(const SegmentAddress& address, node::SinkPropertiesBase* output_sink) final;
 
+    void drop_output(const SegmentAddress& address) final;
+
     virtual void do_add_input(const SegmentAddress& address, node::SourcePropertiesBase* input_source) = 0;
     virtual void do_add_output(const SegmentAddress& address, node::SinkPropertiesBase* output_sink)   = 0;
+    virtual void do_drop_output(const SegmentAddress& address)                                         = 0;
 
     PortName m_port_name;
     pipeline::Resources& m_resources;
     std::string m_info;
+    std::unordered_map<SegmentAddress, pipeline::Resources*> m_segment_resources;
+    mutable std::mutex m_segment_resources_mutex;
 };
 
 }  // namespace srf::manifold
@@ -0,0 +1,95 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/core/bitmap.hpp>
+#include <srf/memory/resources/memory_resource.hpp>
+
+#include <glog/logging.h>
+#include <hwloc.h>
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace srf::memory {
+
+/**
+ * @brief Host memory resource whose allocations are bound to a set of NUMA nodes
+ *
+ * Memory is obtained from hwloc_alloc_membind, i.e. it is mapped at page granularity and bound to numa_set before it
+ * is first touched. If the platform does not permit memory binding, allocations fall back to unbound host memory.
+ *
+ * The hwloc topology is not owned by the resource and must outlive it.
+ */
+class numa_memory_resource final : public memory_resource<::cuda::memory_kind::host>
+{
+    void* do_allocate(std::size_t bytes, std::size_t /*__alignment*/) final
+    {
+        // don't allocate anything if the user requested zero bytes
+        if (0 == bytes)
+        {
+            return nullptr;
+        }
+
+        // page aligned, which satisfies any alignment supported by the host views
+        void* ptr =
+            hwloc_alloc_membind(m_topology, bytes, &m_numa_set.bitmap(), HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_BYNODESET);
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc{};
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t /*__alignment*/) final
+    {
+        if (nullptr == ptr)
+        {
+            return;
+        }
+        CHECK_EQ(hwloc_free(m_topology, ptr, bytes), 0);
+    }
+
+    memory_kind_type do_kind() const final
+    {
+        return memory_kind_type::host;
+    }
+
+  public:
+    numa_memory_resource(hwloc_topology_t topology, NumaSet numa_set) :
+      memory_resource("numa"),
+      m_topology(topology),
+      m_numa_set(std::move(numa_set))
+    {
+        CHECK(m_topology);
+        CHECK(!m_numa_set.empty());
+    }
+    ~numa_memory_resource() override = default;
+
+    const NumaSet& numa_set() const
+    {
+        return m_numa_set;
+    }
+
+  private:
+    hwloc_topology_t m_topology;
+    NumaSet m_numa_set;
+};
+
+}  // namespace srf::memory
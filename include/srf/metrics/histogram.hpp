@@ -0,0 +1,53 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace prometheus {
+class Histogram;
+}
+
+namespace srf::metrics {
+
+class Histogram
+{
+  public:
+    explicit Histogram(prometheus::Histogram*);
+
+    Histogram(const Histogram&) = default;
+    Histogram& operator=(const Histogram&) = default;
+
+    Histogram(Histogram&&) noexcept = default;
+    Histogram& operator=(Histogram&&) noexcept = default;
+
+    void observe(double value);
+
+    /**
+     * @brief add pre-bucketed observations
+     *
+     * @param bucket_increments one entry per bucket boundary plus a final entry for the unbounded bucket
+     * @param sum_of_values sum of all values being added
+     */
+    void observe_multiple(const std::vector<double>& bucket_increments, double sum_of_values);
+
+  private:
+    prometheus::Histogram* m_histogram;
+};
+
+}  // namespace srf::metrics
@@ -18,10 +18,15 @@
 #pragma once
 
 #include <srf/metrics/counter.hpp>
+#include <srf/metrics/gauge.hpp>
+#include <srf/metrics/histogram.hpp>
 
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace prometheus {
 class Registry;
@@ -47,13 +52,34 @@ class Registry
 
     Counter make_counter(std::string name, std::map<std::string, std::string> labels);
     Counter make_throughput_counter(std::string);
+    Gauge make_gauge(std::string name, std::map<std::string, std::string> labels);
+    Histogram make_histogram(std::string name,
+                             std::map<std::string, std::string> labels,
+                             std::vector<double> bucket_boundaries);
+
+    /**
+     * @brief Register a callback which refreshes pull-based metrics; collectors are run before every export
+     */
+    void add_collector(std::function<void()> collector);
 
     std::vector<CounterReport> collect_throughput_counters() const;
 
+    /**
+     * @brief Run all collectors and serialize every metric in the prometheus text exposition format
+     */
+    std::string export_text() const;
+
   protected:
   private:
+    void run_collectors() const;
+
     std::shared_ptr<prometheus::Registry> m_registry;
     prometheus::Family<prometheus::Counter>& m_throughput_counters;
+    std::map<std::string, prometheus::Family<prometheus::Counter>*> m_counter_families;
+    std::map<std::string, prometheus::Family<prometheus::Gauge>*> m_gauge_families;
+    std::map<std::string, prometheus::Family<prometheus::Histogram>*> m_histogram_families;
+    std::vector<std::function<void()>> m_collectors;
+    mutable std::mutex m_mutex;
 };
 
 }  // namespace srf::metrics
@@ -52,6 +52,11 @@ class EdgeBase : public channel::Ingress<SourceT>
         return *m_ingress;
     }
 
+    inline const channel::Ingress<SinkT>& ingress() const
+    {
+        return *m_ingress;
+    }
+
   private:
     std::shared_ptr<channel::Ingress<SinkT>> m_ingress;
 };
@@ -74,6 +79,34 @@ struct Edge<SourceT, SinkT, std::enable_if_t<std::is_convertible_v<SourceT, Sink
     {
         return this->ingress().await_write(std::move(data));
     }
+
+    inline channel::Status try_write(SourceT&& data) final
+    {
+        if constexpr (std::is_same_v<SourceT, SinkT>)
+        {
+            return this->ingress().try_write(std::move(data));
+        }
+        else if constexpr (std::is_convertible_v<const SourceT&, SinkT>)
+        {
+            // convert a copy so the value is left untouched if the sink is full
+            SinkT converted(static_cast<const SourceT&>(data));
+            return this->ingress().try_write(std::move(converted));
+        }
+        else
+        {
+            // converting a move-only value would consume it; this edge can not honor the try_write contract
+            return this->await_write(std::move(data));
+        }
+    }
+
+    bool supports_try_write() const final
+    {
+        if constexpr (std::is_same_v<SourceT, SinkT> || std::is_convertible_v<const SourceT&, SinkT>)
+        {
+            return this->ingress().supports_try_write();
+        }
+        return false;
+    }
 };
 
 }  // namespace srf::node
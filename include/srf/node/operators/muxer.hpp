@@ -31,6 +31,17 @@ class Muxer : public Operator<T>, public SourceChannelWriteable<T>
         return SourceChannelWriteable<T>::await_write(std::move(data));
     }
 
+    // Operator::on_try_next
+    inline channel::Status on_try_next(T&& data) final
+    {
+        return SourceChannelWriteable<T>::try_write(std::move(data));
+    }
+
+    bool supports_try_next() const final
+    {
+        return SourceChannelWriteable<T>::supports_try_write();
+    }
+
     // Operator::on_complete
     void on_complete() final
     {
@@ -20,6 +20,9 @@
 #include <srf/channel/ingress.hpp>
 #include <srf/node/sink_properties.hpp>
 
+#include <memory>
+#include <utility>
+
 namespace srf::node {
 
 struct OperatorBase
@@ -38,6 +41,18 @@ class Operator : public SinkProperties<T>, public OperatorBase, public std::enab
     // forwarding method
     virtual channel::Status on_next(T&& data) = 0;
 
+    // non-blocking forwarding method; operators which can not honor the try_write contract forward to on_next
+    virtual channel::Status on_try_next(T&& data)
+    {
+        return on_next(std::move(data));
+    }
+
+    // true if on_try_next never yields
+    virtual bool supports_try_next() const
+    {
+        return false;
+    }
+
     // called by the IngressAdaptor's destructor
     // this signifies that the last held IngressAdaptor has been releases
     // and the Operator should cascade the on_complete signal
@@ -58,6 +73,16 @@ class Operator : public SinkProperties<T>, public OperatorBase, public std::enab
             return m_parent.on_next(std::move(data));
         }
 
+        inline channel::Status try_write(T&& data) final
+        {
+            return m_parent.on_try_next(std::move(data));
+        }
+
+        bool supports_try_write() const final
+        {
+            return m_parent.supports_try_next();
+        }
+
       private:
         Operator& m_parent;
     };
@@ -79,7 +104,7 @@ std::shared_ptr<channel::Ingress<T>> Operator<T>::channel_ingress()
         delete ptr;
         this_operator.reset();
     });
-    auto m_ingress = ingress;
+    m_ingress = ingress;
     return ingress;
 }
 
@@ -75,6 +75,12 @@ class RxNode : public RxSinkBase<InputT>,
     void do_subscribe(rxcpp::composite_subscription& subscription) final;
     void on_shutdown_critical_section() final;
 
+    // the channel drain loop of RxSinkBase honors retirement
+    bool supports_retirement() const final
+    {
+        return true;
+    }
+
     void on_stop(const rxcpp::subscription& subscription) const final;
     void on_kill(const rxcpp::subscription& subscription) const final;
 
@@ -69,6 +69,13 @@ void RxRunnable<ContextT>::run(ContextT& ctx)
     DVLOG(10) << ctx.info() << " issuing subscribe";
     RxSubscribable::subscribe(subscription);
     DVLOG(10) << ctx.info() << " subscribe completed";
+    if (ctx.retire_requested())
+    {
+        // retired instances leave without taking part in the collective shutdown
+        DVLOG(10) << ctx.info() << " retired";
+        ctx.retire();
+        return;
+    }
     shutdown(ctx);
     DVLOG(10) << ctx.info() << " shutdown completed";
 }
@@ -28,11 +28,13 @@
 #include <srf/node/edge.hpp>
 #include <srf/node/forward.hpp>
 #include <srf/node/sink_channel.hpp>
+#include <srf/runnable/context.hpp>
 #include <srf/utils/type_utils.hpp>
 
 #include <glog/logging.h>
 #include <rxcpp/rx.hpp>
 
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -60,6 +62,9 @@ class RxSinkBase : public SinkChannel<T>, private Watchable
     // this is our channel reader progress engine
     void progress_engine(rxcpp::subscriber<T>& s);
 
+    // read the next item; returns early with Status::timeout if the instance is asked to retire while idle
+    channel::Status read(T& data, runnable::Context* context);
+
     // observable
     rxcpp::observable<T> m_observable;
 };
@@ -80,17 +85,45 @@ template <typename T>
 void RxSinkBase<T>::progress_engine(rxcpp::subscriber<T>& s)
 {
     T data;
+    // null when subscribed outside of a Runnable, e.g. via RxExecute
+    auto* context = runnable::Context::try_get_runtime_context();
     this->watcher_prologue(WatchableEvent::channel_read, &data);
-    while (s.is_subscribed() && (SinkChannel<T>::egress().await_read(data) == channel::Status::success))
+    while (s.is_subscribed() && (context == nullptr || !context->retire_requested()) &&
+           (read(data, context) == channel::Status::success))
     {
         this->watcher_epilogue(WatchableEvent::channel_read, true, &data);
         this->watcher_prologue(WatchableEvent::sink_on_data, &data);
         s.on_next(std::move(data));
+        if (context != nullptr)
+        {
+            context->consume_yield_budget();
+        }
         this->watcher_prologue(WatchableEvent::channel_read, &data);
     }
     s.on_completed();
 }
 
+template <typename T>
+channel::Status RxSinkBase<T>::read(T& data, runnable::Context* context)
+{
+    // the oldest active instance is retired last, so the only active instance is never asked to retire
+    if (context == nullptr || !context->retirable() || context->size() <= 1)
+    {
+        return SinkChannel<T>::egress().await_read(data);
+    }
+
+    // boost channels can not wake a single reader without data, so an idle reader rechecks for retirement periodically
+    while (true)
+    {
+        auto deadline = channel::clock_t::now() + std::chrono::milliseconds(SRF_RETIRE_POLL_PERIOD_MS);
+        auto status   = SinkChannel<T>::egress().await_read_until(data, deadline);
+        if (status != channel::Status::timeout || context->retire_requested())
+        {
+            return status;
+        }
+    }
+}
+
 template <typename T>
 void RxSinkBase<T>::sink_add_watcher(std::shared_ptr<WatcherInterface> watcher)
 {
@@ -53,6 +53,22 @@ class SourceChannel : public SourceProperties<T>, private channel::Ingress<T>
         return no_channel(std::move(data));
     }
 
+    inline channel::Status try_write(T&& data) final
+    {
+        if (m_ingress)
+        {
+            return m_ingress->try_write(std::move(data));
+        }
+
+        return no_channel(std::move(data));
+    }
+
+    // without a channel, writes are handled by no_channel which never yields
+    bool supports_try_write() const final
+    {
+        return !m_ingress || m_ingress->supports_try_write();
+    }
+
     bool has_channel() const
     {
         return bool(m_ingress);
@@ -94,6 +110,8 @@ class SourceChannelWriteable : public SourceChannel<T>
 {
   public:
     using SourceChannel<T>::await_write;
+    using SourceChannel<T>::try_write;
+    using SourceChannel<T>::supports_try_write;
 
   private:
     channel::Status no_channel(T&& data) final
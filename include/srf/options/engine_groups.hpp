@@ -19,6 +19,7 @@
 
 #include <srf/runnable/types.hpp>
 
+#include <chrono>
 #include <functional>
 #include <map>
 
@@ -34,6 +35,19 @@ namespace srf {
  */
 extern std::string default_engine_factory_name();
 
+/**
+ * @brief Order in which an EngineFactory hands out the logical cpus of its CpuSet to Engines
+ *
+ * LogicalCpuOrder walks the CpuSet in bitmap order, which on most hosts places consecutive engines on SMT siblings of
+ * the same physical core. SpreadCores first assigns one hardware thread of every physical core in the CpuSet and only
+ * then moves on to the remaining SMT siblings.
+ */
+enum class EnginePlacement
+{
+    LogicalCpuOrder,
+    SpreadCores,
+};
+
 struct EngineFactoryOptions
 {
     // number of logical cpus requested
@@ -50,6 +64,16 @@ struct EngineFactoryOptions
     // intersection with the union of all other groups is the nullset.
     // if true, the CpuSet assigned to this group can have full or partial overlap with other groups
     bool allow_overlap{false};
+
+    // busy poll - if true, the fiber threads of this group spin with a cpu pause instead of immediately blocking in
+    // the kernel when they run out of ready fibers; after busy_poll_timeout without work they block as usual.
+    // intended for latency critical groups with dedicated logical cpus; has no effect on thread engines
+    bool busy_poll{false};
+    std::chrono::microseconds busy_poll_timeout{std::chrono::microseconds(100)};
+
+    // placement - order in which the logical cpus of this group are assigned to engines; SpreadCores avoids placing
+    // two busy engines on hyperthread siblings while other physical cores of the group are idle
+    EnginePlacement placement{EnginePlacement::LogicalCpuOrder};
 };
 
 /**
@@ -65,6 +89,7 @@ class EngineGroups final
     void set_dedicated_main_thread(bool default_false);
     void set_dedicated_network_thread(bool default_false);
     void set_default_engine_type(runnable::EngineType engine_type);
+    void set_default_engine_placement(EnginePlacement placement);
 
     const EngineFactoryOptions& engine_group_options(const std::string& name) const;
 
@@ -76,11 +101,13 @@ class EngineGroups final
     bool dedicated_main_thread() const;
     bool dedicated_network_thread() const;
     runnable::EngineType default_engine_type() const;
+    EnginePlacement default_engine_placement() const;
 
   private:
     bool m_dedicated_main_thread{false};
     bool m_dedicated_network_thread{false};
     runnable::EngineType m_default_engine_type{runnable::EngineType::Fiber};
+    EnginePlacement m_default_engine_placement{EnginePlacement::LogicalCpuOrder};
     std::map<std::string, EngineFactoryOptions> m_engine_resource_groups;
 };
 
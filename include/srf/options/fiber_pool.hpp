@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace srf {
 
 class FiberPoolOptions
@@ -39,14 +41,71 @@ class FiberPoolOptions
      **/
     FiberPoolOptions& enable_tracing_scheduler(bool default_false);
 
+    /**
+     * @brief enable work stealing between fiber task queues
+     *
+     * Ready fibers may migrate from a busy fiber task queue to an idle one; idle queues steal from peers on the
+     * same NUMA node before crossing to a remote node, and always take the highest priority ready fiber available.
+     * Fibers are no longer pinned to the logical cpu of the queue on which they were enqueued, so thread-local state
+     * must not be relied upon across suspension points.
+     **/
+    FiberPoolOptions& enable_work_stealing(bool default_false);
+
+    /**
+     * @brief enable earliest-deadline-first scheduling
+     *
+     * Fibers launched with a FiberMetaData::deadline run in order of their absolute deadline with priority as a
+     * tiebreak; fibers without a deadline only run when no deadline fiber is ready. Cannot be combined with work
+     * stealing.
+     **/
+    FiberPoolOptions& enable_deadline_scheduling(bool default_false);
+
+    /**
+     * @brief enable scheduler telemetry
+     *
+     * Each fiber task queue records context switches, ready queue lengths, idle time and run time per priority class;
+     * the statistics are exported to each pipeline's metrics::Registry.
+     **/
+    FiberPoolOptions& enable_scheduler_telemetry(bool default_true);
+
+    /**
+     * @brief size in bytes of each fiber stack; 0 selects the boost::context default
+     *
+     * Stacks are drawn from a pool owned by each fiber task queue, allocated on the queue's numa node when memory
+     * binding is enabled, and reused when fibers exit.
+     **/
+    FiberPoolOptions& stack_size(std::size_t bytes);
+
+    /**
+     * @brief protect the page below each fiber stack so an overflow faults instead of corrupting memory
+     **/
+    FiberPoolOptions& enable_stack_guard_pages(bool default_true);
+
+    /**
+     * @brief maximum number of idle fiber stacks retained for reuse by each fiber task queue
+     **/
+    FiberPoolOptions& stack_pool_capacity(std::size_t count);
+
     [[nodiscard]] bool enable_memory_binding() const;
     [[nodiscard]] bool enable_thread_binding() const;
     [[nodiscard]] bool enable_tracing_scheduler() const;
+    [[nodiscard]] bool enable_work_stealing() const;
+    [[nodiscard]] bool enable_deadline_scheduling() const;
+    [[nodiscard]] bool enable_scheduler_telemetry() const;
+    [[nodiscard]] std::size_t stack_size() const;
+    [[nodiscard]] bool enable_stack_guard_pages() const;
+    [[nodiscard]] std::size_t stack_pool_capacity() const;
 
   private:
     bool m_enable_memory_binding{true};
     bool m_enable_thread_binding{true};
     bool m_enable_tracing_scheduler{false};
+    bool m_enable_work_stealing{false};
+    bool m_enable_deadline_scheduling{false};
+    bool m_enable_scheduler_telemetry{true};
+    std::size_t m_stack_size{0};
+    bool m_enable_stack_guard_pages{true};
+    std::size_t m_stack_pool_capacity{256};
 };
 
 }  // namespace srf
@@ -23,6 +23,8 @@
 #include <srf/runnable/launch_control.hpp>
 #include "srf/core/fiber_meta_data.hpp"
 
+#include <cstddef>
+
 namespace srf::pipeline {
 
 struct Resources
@@ -31,6 +33,11 @@ struct Resources
 
     virtual core::FiberTaskQueue& main()              = 0;
     virtual runnable::LaunchControl& launch_control() = 0;
+
+    /**
+     * @brief Index of the host partition (NUMA domain) which owns these resources; used as a locality hint
+     */
+    virtual std::size_t host_partition_id() const = 0;
     // virtual std::shared_ptr<metrics::Registry> metrics_registry() = 0;
 };
 
@@ -22,7 +22,11 @@
 
 #include <glog/logging.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -37,6 +41,9 @@ class Runner;
  * A unique Context is provided by the Launcher for each concurrent instance of Runnable. The Context provides
  * the rank() of the current instances, the number of instances via size() and a barrier() method to collectively
  * synchronize all instances.
+ *
+ * Instances may be added to or retired from a running Runnable via the Runner; size() then reflects the number of
+ * active instances and ranks remain unique, but are no longer guaranteed to be contiguous.
  */
 class Context
 {
@@ -65,8 +72,40 @@ class Context
         return *up;
     }
 
+    /**
+     * @brief Charge one unit of work against the cooperative yield budget; yields once the budget is exhausted
+     *
+     * Invoked by the channel drain loops of sinks and nodes for each item processed. A no-op unless the Runnable was
+     * launched with LaunchOptions::yield_budget_items or LaunchOptions::yield_budget_time.
+     */
+    void consume_yield_budget();
+
+    /**
+     * @brief true if the Runnable was launched with LaunchOptions::retirable, i.e. this instance may be asked to retire
+     */
+    bool retirable() const;
+
+    /**
+     * @brief true once the Runner has asked this instance to retire
+     *
+     * A retiring instance should finish the work in hand, call retire() and return without reaching any further
+     * barrier(). Channel drain loops of sinks and nodes honor this automatically, including while idle; Runnables
+     * which honor it must override Runnable::supports_retirement.
+     */
+    bool retire_requested() const;
+
+    /**
+     * @brief leave the group of instances; peers no longer wait on this instance in barrier()
+     */
+    void retire();
+
     static Context& get_runtime_context();
 
+    /**
+     * @brief Context of the Runnable executing on the calling fiber, or nullptr if there is none
+     */
+    static Context* try_get_runtime_context();
+
     void set_exception(std::exception_ptr exception_ptr);
 
   protected:
@@ -75,19 +114,44 @@ class Context
     void finish();
     virtual void init_info(std::stringstream& ss);
 
+    /**
+     * @brief number of barrier() calls passed while this collective had a single instance; a peer added later must
+     * skip these in addition to the generations completed by the shared barrier
+     */
+    std::uint64_t solo_barriers() const;
+
   private:
+    // set once the collective has, or has had, more than one instance; until then lock, unlock and barrier are not
+    // forwarded. the remaining bits count the barriers passed before the collective grew
+    static constexpr std::uint64_t collective_bit = std::uint64_t(1) << 63;
+
     std::size_t m_rank;
-    std::size_t m_size;
+    std::atomic<std::size_t> m_size;
+    std::atomic<std::uint64_t> m_collective_state;
+    bool m_locked{false};
+    bool m_retirable{false};
+    std::atomic<bool> m_retire_requested{false};
     std::string m_info{"Uninitialized Context"};
     std::exception_ptr m_exception_ptr{nullptr};
     const Runner* m_runner{nullptr};
 
+    // cooperative yield budget; zero disables the respective limit
+    void set_yield_budget(std::size_t items, std::chrono::microseconds time);
+    std::size_t m_yield_budget_items{0};
+    std::chrono::microseconds m_yield_budget_time{std::chrono::microseconds::zero()};
+    std::size_t m_items_since_yield{0};
+    std::chrono::steady_clock::time_point m_last_yield;
+
     virtual void do_lock()                          = 0;
     virtual void do_unlock()                        = 0;
     virtual void do_barrier()                       = 0;
     virtual void do_yield()                         = 0;
     virtual EngineType do_execution_context() const = 0;
 
+    // construct a context for a new instance which joins the same collective as this context
+    virtual std::shared_ptr<Context> do_make_peer(std::size_t rank, std::size_t size) = 0;
+    virtual void do_retire()                                                         = 0;
+
     friend class Runner;
 };
 
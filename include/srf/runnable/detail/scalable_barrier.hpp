@@ -0,0 +1,103 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace srf::runnable::detail {
+
+/**
+ * @brief Reusable barrier whose number of parties can change while in use
+ *
+ * Parties may enroll or withdraw between, or during, generations. enroll() returns the number of generations already
+ * completed, so a party joining late can skip the barrier() calls its peers have already passed. Parameterized on the
+ * mutex and condition variable so the same logic serves both fibers and threads.
+ */
+template <typename MutexT, typename ConditionVariableT>
+class ScalableBarrier final
+{
+  public:
+    explicit ScalableBarrier(std::size_t parties) : m_parties(parties)
+    {
+        CHECK_GT(m_parties, 0);
+    }
+
+    ScalableBarrier(const ScalableBarrier&) = delete;
+    ScalableBarrier& operator=(const ScalableBarrier&) = delete;
+
+    /**
+     * @brief block until all enrolled parties have arrived; returns true for the arrival which released the generation
+     */
+    bool wait()
+    {
+        std::unique_lock<MutexT> lock(m_mutex);
+        const auto generation = m_generation;
+        if (++m_arrived == m_parties)
+        {
+            release(lock);
+            return true;
+        }
+        m_cv.wait(lock, [this, generation] { return generation != m_generation; });
+        return false;
+    }
+
+    /**
+     * @brief add a party; returns the number of completed generations the new party must not wait on
+     */
+    std::uint64_t enroll()
+    {
+        std::lock_guard<MutexT> lock(m_mutex);
+        ++m_parties;
+        return m_generation;
+    }
+
+    /**
+     * @brief remove a party which has not arrived at the current generation and will not wait again
+     */
+    void withdraw()
+    {
+        std::unique_lock<MutexT> lock(m_mutex);
+        CHECK_GT(m_parties, 1) << "the last party of a barrier can not withdraw";
+        --m_parties;
+        if (m_arrived != 0 && m_arrived == m_parties)
+        {
+            release(lock);
+        }
+    }
+
+  private:
+    void release(std::unique_lock<MutexT>& lock)
+    {
+        m_arrived = 0;
+        ++m_generation;
+        lock.unlock();
+        m_cv.notify_all();
+    }
+
+    MutexT m_mutex;
+    ConditionVariableT m_cv;
+    std::size_t m_parties;
+    std::size_t m_arrived{0};
+    std::uint64_t m_generation{0};
+};
+
+}  // namespace srf::runnable::detail
@@ -19,15 +19,20 @@
 
 #include <srf/forward.hpp>
 #include <srf/runnable/context.hpp>
+#include <srf/runnable/detail/scalable_barrier.hpp>
 #include <srf/runnable/forward.hpp>
 
 #include <srf/utils/string_utils.hpp>
 #include <srf/utils/type_utils.hpp>
 
-#include <boost/fiber/barrier.hpp>
+#include <boost/fiber/condition_variable.hpp>
 #include <boost/fiber/mutex.hpp>
 #include <boost/fiber/operations.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <sstream>  // for stringstream
 #include <string>
 
@@ -45,13 +50,23 @@ class FiberContextResources
         m_barrier.wait();
     }
 
+    std::uint64_t enroll()
+    {
+        return m_barrier.enroll();
+    }
+
+    void withdraw()
+    {
+        m_barrier.withdraw();
+    }
+
     boost::fibers::mutex& mutex()
     {
         return m_mutex;
     }
 
   private:
-    boost::fibers::barrier m_barrier;
+    detail::ScalableBarrier<boost::fibers::mutex, boost::fibers::condition_variable> m_barrier;
     boost::fibers::mutex m_mutex;
 };
 
@@ -67,10 +82,16 @@ class FiberContext final : public ContextT
     using resource_t = FiberContextResources;
 
     template <typename... ArgsT>
-    explicit FiberContext(std::shared_ptr<FiberContextResources> fiber_resources, ArgsT&&... args) :
-      ContextT(std::forward<ArgsT>(args)...),
+    explicit FiberContext(std::shared_ptr<FiberContextResources> fiber_resources,
+                          std::size_t rank,
+                          std::size_t size,
+                          ArgsT&&... args) :
+      ContextT(rank, size, args...),
       m_fiber_resources(std::move(fiber_resources)),
-      m_lock(m_fiber_resources->mutex())
+      m_lock(m_fiber_resources->mutex()),
+      m_make_peer([args...](std::shared_ptr<FiberContextResources> resources, std::size_t rank, std::size_t size) {
+          return std::make_shared<FiberContext>(std::move(resources), rank, size, args...);
+      })
     {
         // the mutex is locked on the construction of m_lock
         m_lock.unlock();
@@ -101,6 +122,12 @@ class FiberContext final : public ContextT
 
     void do_barrier() final
     {
+        // a peer added to a running collective skips the generations completed before it enrolled
+        if (m_skip_barriers != 0)
+        {
+            --m_skip_barriers;
+            return;
+        }
         m_fiber_resources->barrier();
     }
 
@@ -114,8 +141,23 @@ class FiberContext final : public ContextT
         return EngineType::Fiber;
     }
 
+    std::shared_ptr<Context> do_make_peer(std::size_t rank, std::size_t size) final
+    {
+        auto peer             = m_make_peer(m_fiber_resources, rank, size);
+        peer->m_skip_barriers = m_fiber_resources->enroll() + this->solo_barriers();
+        return peer;
+    }
+
+    void do_retire() final
+    {
+        m_fiber_resources->withdraw();
+    }
+
     std::shared_ptr<FiberContextResources> m_fiber_resources;
     std::unique_lock<boost::fibers::mutex> m_lock;
+    std::function<std::shared_ptr<FiberContext>(std::shared_ptr<FiberContextResources>, std::size_t, std::size_t)>
+        m_make_peer;
+    std::uint64_t m_skip_barriers{0};
 };
 
 }  // namespace srf::runnable
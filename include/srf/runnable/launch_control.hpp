@@ -248,6 +248,15 @@ class LaunchControl final
         return nullptr;
     }
 
+    /**
+     * @brief Build engines from the engine factory named by the options, e.g. to grow a running Runnable via
+     * Runner::add_engines
+     */
+    std::shared_ptr<Engines> build_engines(const LaunchOptions& launch_options) const
+    {
+        return get_engine_factory(launch_options.engine_factory_name).build_engines(launch_options);
+    }
+
   protected:
     /**
      * @brief Determine if the user has specified any specific options for the given Runnable
@@ -269,11 +278,6 @@ class LaunchControl final
     //     return config().default_options;
     // }
 
-    std::shared_ptr<Engines> build_engines(const LaunchOptions& launch_options) const
-    {
-        return get_engine_factory(launch_options.engine_factory_name).build_engines(launch_options);
-    }
-
     /**
      * @brief Get the resource group object
      *
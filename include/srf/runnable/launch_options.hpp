@@ -21,6 +21,7 @@
 #include <srf/options/engine_groups.hpp>
 #include <srf/runnable/types.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 
@@ -38,6 +39,19 @@ struct LaunchOptions
     std::size_t pe_count{1};
     std::size_t engines_per_pe{1};
     std::string engine_factory_name{default_engine_factory_name()};
+
+    // relative deadline applied to fiber engines; see FiberMetaData::deadline
+    std::chrono::nanoseconds deadline{std::chrono::nanoseconds::zero()};
+
+    // cooperative yield budget of each instance's channel drain loop; an instance yields after processing
+    // yield_budget_items items or running for yield_budget_time since its last budgeted yield, whichever comes first.
+    // zero disables the respective limit
+    std::size_t yield_budget_items{0};
+    std::chrono::microseconds yield_budget_time{std::chrono::microseconds::zero()};
+
+    // allow Runner::retire_engines; idle instances then recheck for retirement every SRF_RETIRE_POLL_PERIOD_MS
+    // instead of blocking on their channel
+    bool retirable{false};
 };
 
 struct ServiceLaunchOptions : public LaunchOptions
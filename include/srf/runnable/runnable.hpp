@@ -85,6 +85,12 @@ class Runnable
      */
     virtual void on_state_update(const State&);
 
+    /**
+     * @brief Override to report that every instance observes Context::retire_requested() and retires promptly, even
+     * while waiting for input; Runner::retire_engines is rejected for Runnables which do not
+     */
+    virtual bool supports_retirement() const;
+
     std::atomic<State> m_state{State::Init};
 
     friend class Runner;
@@ -29,6 +29,7 @@
 #include <glog/logging.h>
 
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -56,6 +57,8 @@ namespace srf::runnable {
  * immediate scope of the callback method.
  *
  * After enqueued, the unique_ptr from make_runner maybe stored in any container that holds unique_ptr<Runnable>.
+ *
+ * Once running, the number of instances may be changed with add_engines and retire_engines.
  */
 class Runner
 {
@@ -124,6 +127,31 @@ class Runner
      */
     void kill() const;
 
+    /**
+     * @brief Launch one additional instance of the running Runnable on each of the given engines
+     *
+     * New instances take the next unused ranks, share the collective barrier of the existing instances and read from
+     * the same channels. The size() of every active Context is updated. Throws if the Runnable is not running.
+     */
+    void add_engines(std::shared_ptr<Engines> engines);
+
+    /**
+     * @brief Ask the count most recently launched active instances to retire
+     *
+     * A retiring instance finishes the item in hand, or stops waiting for input within SRF_RETIRE_POLL_PERIOD_MS if
+     * its channel is idle, then leaves the collective and completes without closing any downstream channels. At least
+     * one instance always remains active; the size() of the remaining Contexts is updated immediately. Throws if the
+     * Runnable was not launched with LaunchOptions::retirable or does not support retirement, e.g. sources, which
+     * only stop when their data is exhausted.
+     */
+    void retire_engines(std::size_t count);
+
+    /**
+     * @brief Number of instances neither completed nor asked to retire; instances asked to retire may still be
+     * finishing
+     */
+    std::size_t active_instances() const;
+
     /**
      * @brief Access the const version of the Runnable
      */
@@ -161,10 +189,10 @@ class Runner
     };
 
     /**
-     * @brief State of running instances
-     * @return const std::vector<Instance>
+     * @brief State of running instances, indexed by rank
+     * @return const std::deque<Instance>
      */
-    const std::vector<Instance>& instances() const;
+    const std::deque<Instance>& instances() const;
 
   protected:
     void enqueue(std::shared_ptr<Engines>, std::vector<std::shared_ptr<Context>>&&);
@@ -181,6 +209,16 @@ class Runner
      */
     void update_state(std::size_t launcher_id, State new_state);
 
+    /**
+     * @brief Launch the Runnable on the engine of an instance
+     */
+    void launch(Instance& instance, const LaunchOptions& launch_options);
+
+    /**
+     * @brief Active instances, in launch order; must be called while holding m_mutex
+     */
+    std::vector<Instance*> get_active_instances() const;
+
     // callback lambda executed on state change
     on_instance_state_change_t m_on_instance_state_change{nullptr};
 
@@ -194,12 +232,16 @@ class Runner
     // using shared_ptr to allow python access; otherwise a unique_ptr woudld used
     std::unique_ptr<Runnable> m_runnable;
 
-    // 1:1 mapping to contexts, but hold the runner specific states for each instance
-    mutable std::vector<Instance> m_instances;
+    // 1:1 mapping to contexts, but hold the runner specific states for each instance; a deque so references held by
+    // running instances remain valid as engines are added
+    mutable std::deque<Instance> m_instances;
 
     // simple bool to disable launching this runner/runnable
     bool m_can_run{true};
 
+    // instances may be asked to retire; set from the LaunchOptions of the initial launch
+    bool m_retirable{false};
+
     mutable std::recursive_mutex m_mutex;
 
     friend class Launcher;
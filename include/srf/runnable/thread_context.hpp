@@ -17,9 +17,9 @@
 
 #pragma once
 
-#include <srf/core/thread_barrier.hpp>
 #include <srf/forward.hpp>
 #include <srf/runnable/context.hpp>
+#include <srf/runnable/detail/scalable_barrier.hpp>
 #include <srf/runnable/forward.hpp>
 
 #include <srf/utils/string_utils.hpp>
@@ -27,6 +27,11 @@
 
 #include <glog/logging.h>
 
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -46,13 +51,23 @@ class ThreadContextResources
         m_barrier.wait();
     }
 
+    std::uint64_t enroll()
+    {
+        return m_barrier.enroll();
+    }
+
+    void withdraw()
+    {
+        m_barrier.withdraw();
+    }
+
     std::mutex& mutex()
     {
         return m_mutex;
     }
 
   private:
-    thread_barrier m_barrier;
+    detail::ScalableBarrier<std::mutex, std::condition_variable> m_barrier;
     std::mutex m_mutex;
 };
 
@@ -68,10 +83,16 @@ class ThreadContext final : public ContextT
     using resource_t = ThreadContextResources;
 
     template <typename... ArgsT>
-    explicit ThreadContext(std::shared_ptr<ThreadContextResources> resources, ArgsT&&... args) :
-      ContextT(std::forward<ArgsT>(args)...),
+    explicit ThreadContext(std::shared_ptr<ThreadContextResources> resources,
+                           std::size_t rank,
+                           std::size_t size,
+                           ArgsT&&... args) :
+      ContextT(rank, size, args...),
       m_resources(std::move(resources)),
-      m_lock(m_resources->mutex())
+      m_lock(m_resources->mutex()),
+      m_make_peer([args...](std::shared_ptr<ThreadContextResources> resources, std::size_t rank, std::size_t size) {
+          return std::make_shared<ThreadContext>(std::move(resources), rank, size, args...);
+      })
     {
         // the mutex is locked on the construction of m_lock
         m_lock.unlock();
@@ -102,6 +123,12 @@ class ThreadContext final : public ContextT
 
     void do_barrier() final
     {
+        // a peer added to a running collective skips the generations completed before it enrolled
+        if (m_skip_barriers != 0)
+        {
+            --m_skip_barriers;
+            return;
+        }
         m_resources->barrier();
     }
 
@@ -115,8 +142,23 @@ class ThreadContext final : public ContextT
         return EngineType::Thread;
     }
 
+    std::shared_ptr<Context> do_make_peer(std::size_t rank, std::size_t size) final
+    {
+        auto peer             = m_make_peer(m_resources, rank, size);
+        peer->m_skip_barriers = m_resources->enroll() + this->solo_barriers();
+        return peer;
+    }
+
+    void do_retire() final
+    {
+        m_resources->withdraw();
+    }
+
     std::shared_ptr<ThreadContextResources> m_resources;
     std::unique_lock<std::mutex> m_lock;
+    std::function<std::shared_ptr<ThreadContext>(std::shared_ptr<ThreadContextResources>, std::size_t, std::size_t)>
+        m_make_peer;
+    std::uint64_t m_skip_barriers{0};
 };
 
 }  // namespace srf::runnable
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <srf/codable/encoding_options.hpp>
 #include <srf/manifold/connectable.hpp>
 #include <srf/manifold/factory.hpp>
 #include <srf/manifold/interface.hpp>
@@ -27,7 +28,6 @@
 #include <srf/node/sink_channel.hpp>
 #include <srf/node/source_channel.hpp>
 #include <srf/node/source_properties.hpp>
-#include <srf/runnable/launchable.hpp>
 #include <srf/segment/object.hpp>
 
 #include <condition_variable>
@@ -41,11 +41,38 @@ namespace srf::segment {
 
 class Instance;
 
-class EgressPortBase : public runnable::Launchable, public manifold::Connectable, public virtual ObjectProperties
+class EgressPortBase : public manifold::Connectable, public virtual ObjectProperties
 {
+  public:
+    /**
+     * @brief Options used to encode the objects which leave the segment through this port for a remote instance
+     *
+     * Set when the segment is built from the port's entry in SegmentOptions::egress_eager_thresholds.
+     */
+    const codable::EncodingOptions& encoding_options() const
+    {
+        return m_encoding_options;
+    }
+
+    void set_encoding_options(codable::EncodingOptions options)
+    {
+        m_encoding_options = std::move(options);
+    }
+
+  private:
+    codable::EncodingOptions m_encoding_options;
+
     friend Instance;
 };
 
+/**
+ * @brief An EgressPort is a pass-through between the nodes of a segment and the ingress of a manifold.
+ *
+ * The port is backed by a Muxer operator rather than a runnable node, so writes from upstream nodes are forwarded
+ * directly into the manifold's ingress without an additional channel transfer or progress engine.
+ *
+ * @tparam T
+ */
 template <typename T>
 class EgressPort final : public Object<node::SinkProperties<T>>,
                          public EgressPortBase,
@@ -60,24 +87,16 @@ class EgressPort final : public Object<node::SinkProperties<T>>,
     EgressPort(SegmentAddress address, PortName name) :
       m_segment_address(address),
       m_port_name(std::move(name)),
-      m_sink(std::make_unique<node::RxNode<T>>())
+      m_sink(std::make_shared<node::Muxer<T>>())
     {}
 
   private:
     node::SinkProperties<T>* get_object() const final
     {
-        CHECK(m_sink) << "failed to acquire backing runnable for egress port " << m_port_name;
+        CHECK(m_sink) << "failed to acquire backing operator for egress port " << m_port_name;
         return m_sink.get();
     }
 
-    std::unique_ptr<runnable::Launcher> prepare_launcher(runnable::LaunchControl& launch_control) final
-    {
-        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
-        CHECK(m_sink);
-        CHECK(m_manifold_connected) << "manifold not set for egress port";
-        return launch_control.prepare_launcher(std::move(m_sink));
-    }
-
     std::shared_ptr<manifold::Interface> make_manifold(pipeline::Resources& resources) final
     {
         return manifold::Factory<T>::make_manifold(m_port_name, resources);
@@ -96,9 +115,8 @@ class EgressPort final : public Object<node::SinkProperties<T>>,
 
     SegmentAddress m_segment_address;
     PortName m_port_name;
-    std::unique_ptr<node::RxNode<T>> m_sink;
+    std::shared_ptr<node::Muxer<T>> m_sink;
     bool m_manifold_connected{false};
-    runnable::LaunchOptions m_launch_options;
     std::mutex m_mutex;
 };
 
@@ -26,7 +26,6 @@
 #include <srf/node/rx_node.hpp>
 #include <srf/node/sink_channel.hpp>
 #include <srf/node/source_channel.hpp>
-#include <srf/runnable/launchable.hpp>
 #include <srf/segment/object.hpp>
 #include "srf/node/forward.hpp"
 
@@ -38,11 +37,19 @@ namespace srf::segment {
 
 class Instance;
 
-struct IngressPortBase : public runnable::Launchable, public manifold::Connectable, public virtual ObjectProperties
+struct IngressPortBase : public manifold::Connectable, public virtual ObjectProperties
 {
     friend Instance;
 };
 
+/**
+ * @brief An IngressPort is a pass-through between the egress of a manifold and the nodes of a segment.
+ *
+ * The port is backed by a Muxer operator rather than a runnable node, so the manifold's egress writes directly into
+ * the channel of the downstream node.
+ *
+ * @tparam T
+ */
 template <typename T>
 class IngressPort : public Object<node::SourceProperties<T>>, public IngressPortBase
 {
@@ -55,7 +62,7 @@ class IngressPort : public Object<node::SourceProperties<T>>, public IngressPort
     IngressPort(SegmentAddress address, PortName name) :
       m_segment_address(address),
       m_port_name(std::move(name)),
-      m_source(std::make_unique<node::RxNode<T>>())
+      m_source(std::make_shared<node::Muxer<T>>())
     {}
 
   private:
@@ -65,13 +72,6 @@ class IngressPort : public Object<node::SourceProperties<T>>, public IngressPort
         return m_source.get();
     }
 
-    std::unique_ptr<runnable::Launcher> prepare_launcher(runnable::LaunchControl& launch_control) final
-    {
-        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
-        CHECK(m_source);
-        return launch_control.prepare_launcher(std::move(m_source));
-    }
-
     std::shared_ptr<manifold::Interface> make_manifold(pipeline::Resources& resources) final
     {
         return manifold::Factory<T>::make_manifold(m_port_name, resources);
@@ -87,7 +87,7 @@ class IngressPort : public Object<node::SourceProperties<T>>, public IngressPort
 
     SegmentAddress m_segment_address;
     PortName m_port_name;
-    std::unique_ptr<node::RxNode<T>> m_source;
+    std::shared_ptr<node::Muxer<T>> m_source;
     std::mutex m_mutex;
 
     friend Instance;
@@ -0,0 +1,64 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * Fixed little-endian encoding of integers for wire formats which are read by hosts of either byte order.
+ */
+namespace srf::utils::little_endian {
+
+template <typename T>
+inline void store(void* dst, T value)
+{
+    static_assert(std::is_integral_v<T>);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    std::memcpy(dst, &value, sizeof(T));
+#else
+    auto* bytes = static_cast<std::uint8_t*>(dst);
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        bytes[i] = static_cast<std::uint8_t>((static_cast<std::make_unsigned_t<T>>(value) >> (8 * i)) & 0xff);
+    }
+#endif
+}
+
+template <typename T>
+inline T load(const void* src)
+{
+    static_assert(std::is_integral_v<T>);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return value;
+#else
+    const auto* bytes             = static_cast<const std::uint8_t*>(src);
+    std::make_unsigned_t<T> value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<std::make_unsigned_t<T>>(bytes[i]) << (8 * i);
+    }
+    return static_cast<T>(value);
+#endif
+}
+
+}  // namespace srf::utils::little_endian
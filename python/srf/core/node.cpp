@@ -21,6 +21,7 @@
 #include <srf/runnable/launch_options.hpp>
 #include <srf/segment/object.hpp>
 
+#include <pybind11/chrono.h>    // IWYU pragma: keep
 #include <pybind11/pybind11.h>  // IWYU pragma: keep
 
 #include <cstddef>
@@ -40,7 +41,9 @@ PYBIND11_MODULE(node, m)
     py::class_<srf::runnable::LaunchOptions>(m, "LaunchOptions")
         .def_readwrite("pe_count", &srf::runnable::LaunchOptions::pe_count)
         .def_readwrite("engines_per_pe", &srf::runnable::LaunchOptions::engines_per_pe)
-        .def_readwrite("engine_factory_name", &srf::runnable::LaunchOptions::engine_factory_name);
+        .def_readwrite("engine_factory_name", &srf::runnable::LaunchOptions::engine_factory_name)
+        .def_readwrite("yield_budget_items", &srf::runnable::LaunchOptions::yield_budget_items)
+        .def_readwrite("yield_budget_time", &srf::runnable::LaunchOptions::yield_budget_time);
 
     py::class_<srf::segment::ObjectProperties, std::shared_ptr<srf::segment::ObjectProperties>>(m, "SegmentObject")
         .def_property_readonly("name", &PyNode::name)
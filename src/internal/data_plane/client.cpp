@@ -18,6 +18,8 @@
 #include "internal/data_plane/client.hpp"
 
 #include "internal/data_plane/client_worker.hpp"
+#include "internal/data_plane/coalesced_frame.hpp"
+#include "internal/data_plane/send_window.hpp"
 #include "internal/data_plane/tags.hpp"
 #include "internal/utils/contains.hpp"
 
@@ -25,9 +27,7 @@
 #include <srf/channel/buffered_channel.hpp>
 #include <srf/channel/channel.hpp>
 #include <srf/channel/status.hpp>
-#include <srf/codable/encode.hpp>
 #include <srf/codable/encoded_object.hpp>
-#include <srf/codable/protobuf_message.hpp>  // IWYU pragma: keep
 
 #include <srf/exceptions/runtime_error.hpp>
 #include <srf/memory/block.hpp>
@@ -48,19 +48,28 @@
 #include <ucs/memory/memory_type.h>
 #include <ucs/type/status.h>
 #include <boost/fiber/future/future.hpp>
+#include <boost/fiber/operations.hpp>
 #include <boost/fiber/future/promise.hpp>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace srf::internal::data_plane {
 
+// serialized EncodedObject descriptors up to this size are sent from the stack
+static constexpr std::size_t inline_send_bytes = 512;
+
 static void send_completion_handler_with_future(void* request, ucs_status_t status, void* user_data)
 {
     auto* promise = static_cast<Promise<void>*>(user_data);
@@ -78,6 +87,31 @@ static void send_completion_handler_with_future(void* request, ucs_status_t stat
     // we could optimize this a bit more
 }
 
+struct Client::InFlightSend
+{
+    std::unique_ptr<codable::EncodedObject> encoded_object;
+    std::vector<std::uint8_t> descriptors;
+    Promise<void> promise;
+    std::shared_ptr<SendWindow> window;
+};
+
+// the ucx request itself is released by the progress engine
+void Client::async_send_completion_handler(void* request, ucs_status_t status, void* user_data)
+{
+    std::unique_ptr<InFlightSend> send(static_cast<InFlightSend*>(user_data));
+
+    if (status == UCS_OK)
+    {
+        send->promise.set_value();
+    }
+    else
+    {
+        send->promise.set_exception(std::make_exception_ptr(std::runtime_error(ucs_status_string(status))));
+    }
+
+    send->window->release();
+}
+
 Client::Client(std::shared_ptr<ucx::Context> context) : m_worker(std::make_shared<ucx::Worker>(std::move(context))) {}
 
 Client::~Client()
@@ -273,10 +307,44 @@ void Client::get(const protos::RemoteDescriptor& remote_md, Descriptor& buffer)
 }
 */
 
+struct Client::CoalescedBatch
+{
+    CoalescedBatch() : future(promise.get_future()) {}
+
+    std::vector<std::uint8_t> frame;
+    Promise<void> promise;
+    SharedFuture<void> future;
+};
+
+void Client::set_send_coalescing(std::chrono::microseconds window, std::size_t max_batch_bytes)
+{
+    CHECK_GT(max_batch_bytes, coalesced::record_header_bytes);
+    std::lock_guard<decltype(m_coalesce_mutex)> lock(m_coalesce_mutex);
+    m_coalesce_window    = window;
+    m_coalesce_max_bytes = max_batch_bytes;
+}
+
 void Client::await_send(const InstanceID& instance_id,
                         const PortAddress& port_address,
                         const codable::EncodedObject& encoded_object)
 {
+    const auto bytes = encoded_object.serialized_descriptor_bytes();
+
+    // sample both settings together so a concurrent set_send_coalescing is observed either entirely or not at all
+    std::chrono::microseconds window;
+    std::size_t max_batch_bytes;
+    {
+        std::lock_guard<decltype(m_coalesce_mutex)> lock(m_coalesce_mutex);
+        window          = m_coalesce_window;
+        max_batch_bytes = m_coalesce_max_bytes;
+    }
+
+    if (window.count() > 0 && coalesced::record_bytes(bytes) <= max_batch_bytes)
+    {
+        await_send_coalesced(instance_id, port_address, encoded_object, bytes, window, max_batch_bytes);
+        return;
+    }
+
     Promise<void> promise;
     auto future = promise.get_future();
 
@@ -287,17 +355,19 @@ void Client::await_send(const InstanceID& instance_id,
     params.cb.send      = send_completion_handler_with_future;
     params.user_data    = &promise;
 
-    // serialize the proto of the encoded object into it's own encoded object
-    // dogfooding at its best
-    codable::EncodedObject msg;
-    codable::encode(encoded_object.proto(), msg);
-
-    // sanity check
-    // 1) there should be only 1 descriptor, and
-    // 2) the size of the memory block should be the size of the protos requested
-    DCHECK_EQ(msg.descriptor_count(), 1);
-    auto block = msg.memory_block(0);
-    DCHECK_EQ(block.bytes(), encoded_object.proto().ByteSizeLong());
+    // serialize the descriptors of the encoded object directly into a send buffer using the wire format selected by
+    // its EncodingOptions; descriptors are small, so the common case fits in a buffer on the calling fiber's stack and
+    // does not touch the heap. the buffer must outlive the send, which is guaranteed since this method awaits
+    // completion before returning.
+    std::array<std::uint8_t, inline_send_bytes> inline_buffer;
+    std::vector<std::uint8_t> heap_buffer;
+    std::uint8_t* data = inline_buffer.data();
+    if (bytes > inline_buffer.size())
+    {
+        heap_buffer.resize(bytes);
+        data = heap_buffer.data();
+    }
+    encoded_object.serialize_descriptors(data, bytes);
 
     // all encoded_objects are serialized to host memory
     // these are small packed remote descriptors, not the actual payload data
@@ -305,8 +375,7 @@ void Client::await_send(const InstanceID& instance_id,
     params.memory_type = UCS_MEMORY_TYPE_HOST;
 
     // issue send
-    ucs_status_ptr_t request =
-        ucp_tag_send_nbx(endpoint(instance_id).handle(), block.data(), block.bytes(), tag, &params);
+    ucs_status_ptr_t request = ucp_tag_send_nbx(endpoint(instance_id).handle(), data, bytes, tag, &params);
 
     if (request == nullptr /* UCS_OK */)
     {
@@ -328,6 +397,194 @@ void Client::await_send(const InstanceID& instance_id,
     future.get();
 }
 
+void Client::await_send_coalesced(const InstanceID& instance_id,
+                                  const PortAddress& port_address,
+                                  const codable::EncodedObject& encoded_object,
+                                  std::size_t bytes,
+                                  std::chrono::microseconds window,
+                                  std::size_t max_batch_bytes)
+{
+    std::shared_ptr<CoalescedBatch> batch;
+    std::shared_ptr<CoalescedBatch> overflowed;
+    bool leader = false;
+    bool sealed = false;
+
+    {
+        std::lock_guard<decltype(m_coalesce_mutex)> lock(m_coalesce_mutex);
+        auto& open = m_open_batches[instance_id];
+
+        // the record does not fit in the open batch; seal it and start a new one
+        if (open && open->frame.size() + coalesced::record_bytes(bytes) > max_batch_bytes)
+        {
+            overflowed = std::move(open);
+            open.reset();
+        }
+
+        // the first appender to a batch is its leader and is responsible for flushing it when the window expires
+        if (!open)
+        {
+            open = std::make_shared<CoalescedBatch>();
+            open->frame.reserve(max_batch_bytes);
+            leader = true;
+        }
+
+        batch         = open;
+        auto* payload = coalesced::append_record(batch->frame, port_address, bytes);
+        encoded_object.serialize_descriptors(payload, bytes);
+
+        // no room for another record header; seal without waiting for the window
+        if (batch->frame.size() + coalesced::record_header_bytes >= max_batch_bytes)
+        {
+            open.reset();
+            sealed = true;
+        }
+    }
+
+    if (overflowed)
+    {
+        send_batch(instance_id, *overflowed);
+    }
+
+    if (sealed)
+    {
+        send_batch(instance_id, *batch);
+    }
+    else if (leader)
+    {
+        boost::this_fiber::sleep_for(window);
+
+        // the batch may have been sealed by an overflowing appender while the leader slept
+        {
+            std::lock_guard<decltype(m_coalesce_mutex)> lock(m_coalesce_mutex);
+            auto search = m_open_batches.find(instance_id);
+            sealed      = (search != m_open_batches.end() && search->second == batch);
+            if (sealed)
+            {
+                search->second.reset();
+            }
+        }
+
+        if (sealed)
+        {
+            send_batch(instance_id, *batch);
+        }
+    }
+
+    // every participant awaits the completion of the coalesced send which carries its descriptors
+    batch->future.get();
+}
+
+void Client::send_batch(InstanceID instance_id, CoalescedBatch& batch)
+{
+    ucp_request_param_t params;
+
+    params.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_USER_DATA | UCP_OP_ATTR_FIELD_MEMORY_TYPE;
+    params.cb.send      = send_completion_handler_with_future;
+    params.user_data    = &batch.promise;
+    params.memory_type  = UCS_MEMORY_TYPE_HOST;
+
+    // the frame is owned by the batch, which is held by every participant until the send completes
+    ucs_status_ptr_t request = ucp_tag_send_nbx(
+        endpoint(instance_id).handle(), batch.frame.data(), batch.frame.size(), COALESCED_TAG, &params);
+
+    if (request == nullptr /* UCS_OK */)
+    {
+        batch.promise.set_value();
+        return;
+    }
+    if (UCS_PTR_IS_ERR(request))
+    {
+        LOG(ERROR) << "coalesced send failed - " << ucs_status_string(UCS_PTR_STATUS(request));
+        batch.promise.set_exception(std::make_exception_ptr(std::runtime_error("send failed")));
+        return;
+    }
+
+    push_request(std::move(request));
+}
+
+std::shared_ptr<SendWindow> Client::window_for(const InstanceID& instance_id)
+{
+    std::lock_guard<decltype(m_send_windows_mutex)> lock(m_send_windows_mutex);
+    auto& window = m_send_windows[instance_id];
+    if (!window)
+    {
+        window = std::make_shared<SendWindow>(m_send_window);
+    }
+    return window;
+}
+
+std::size_t Client::send_window() const
+{
+    std::lock_guard<decltype(m_send_windows_mutex)> lock(m_send_windows_mutex);
+    return m_send_window;
+}
+
+void Client::set_send_window(std::size_t max_in_flight)
+{
+    CHECK_GT(max_in_flight, 0);
+    std::lock_guard<decltype(m_send_windows_mutex)> lock(m_send_windows_mutex);
+    m_send_window = max_in_flight;
+    for (auto& [instance_id, window] : m_send_windows)
+    {
+        window->set_limit(max_in_flight);
+    }
+}
+
+Future<void> Client::async_send(const InstanceID& instance_id,
+                                const PortAddress& port_address,
+                                std::unique_ptr<codable::EncodedObject> encoded_object)
+{
+    CHECK(encoded_object);
+
+    auto send            = std::make_unique<InFlightSend>();
+    auto future          = send->promise.get_future();
+    send->window         = window_for(instance_id);
+    send->encoded_object = std::move(encoded_object);
+
+    // serialize before acquiring a slot so the window only bounds work that is ready to be issued
+    send->descriptors.resize(send->encoded_object->serialized_descriptor_bytes());
+    send->encoded_object->serialize_descriptors(send->descriptors.data(), send->descriptors.size());
+
+    // acquire a slot in the window; yields the calling fiber until the progress engine retires a completion
+    send->window->acquire();
+
+    ucp_tag_t tag = port_address | INGRESS_TAG;
+    ucp_request_param_t params;
+
+    params.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_USER_DATA | UCP_OP_ATTR_FIELD_MEMORY_TYPE;
+    params.cb.send      = async_send_completion_handler;
+    params.user_data    = send.get();
+    params.memory_type  = UCS_MEMORY_TYPE_HOST;
+
+    ucs_status_ptr_t request = ucp_tag_send_nbx(
+        endpoint(instance_id).handle(), send->descriptors.data(), send->descriptors.size(), tag, &params);
+
+    if (request == nullptr /* UCS_OK */)
+    {
+        // completed immediately; the callback is not invoked
+        send->promise.set_value();
+        send->window->release();
+        return future;
+    }
+    if (UCS_PTR_IS_ERR(request))
+    {
+        LOG(ERROR) << "async send failed - " << ucs_status_string(UCS_PTR_STATUS(request));
+        send->promise.set_exception(std::make_exception_ptr(std::runtime_error("send failed")));
+        send->window->release();
+        return future;
+    }
+
+    // ownership of the in-flight send passes to the completion handler
+    send.release();
+    push_request(std::move(request));
+    return future;
+}
+
+void Client::await_async_sends(const InstanceID& instance_id)
+{
+    window_for(instance_id)->await_idle();
+}
+
 std::size_t Client::connections() const
 {
     return m_endpoints.size();
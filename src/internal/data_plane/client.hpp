@@ -17,11 +17,15 @@
 
 #pragma once
 
+#include "internal/data_plane/send_window.hpp"
 #include "internal/service.hpp"
 
 #include <srf/protos/remote_descriptor.pb.h>
 #include <srf/channel/status.hpp>
+#include <srf/codable/encode.hpp>
 #include <srf/codable/encoded_object.hpp>
+#include <srf/codable/encoded_object_pool.hpp>
+#include <srf/codable/encoding_options.hpp>
 #include <srf/node/source_channel.hpp>
 #include <srf/runnable/launch_control.hpp>
 #include <srf/runnable/runner.hpp>
@@ -34,6 +38,7 @@
 #include <ucp/api/ucp_def.h>
 #include <rxcpp/rx.hpp>  // IWYU pragma: keep
 
+#include <chrono>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -61,6 +66,9 @@ class Client final : public Service
      * the await_send with only port_address and encoded_object; however, the internal should be able to short
      * circuit the translation.
      *
+     * An EncodedObject built with codable::encode_batch carries many objects and is sent as a single tagged message;
+     * the receiver recovers the objects with codable::decode_batch.
+     *
      * @param instance_id
      * @param port_address
      * @param encoded_object
@@ -69,6 +77,60 @@ class Client final : public Service
                     const PortAddress& port_address,
                     const codable::EncodedObject& encoded_object);
 
+    /**
+     * @brief Encode every element of range into one pooled EncodedObject and send it to the PortAddress at InstanceID
+     *
+     * Egress to a remote port should drain what is ready and send it with this method rather than one await_send per
+     * object: the objects share descriptor storage and coalesced host buffers and travel as a single tagged message,
+     * which the receiver splits with codable::decode_batch. Pass the EgressPortBase::encoding_options() of the port the
+     * objects leave through so that per-port settings such as the eager threshold apply.
+     */
+    template <typename RangeT>
+    void await_send_batch(const InstanceID& instance_id,
+                          const PortAddress& port_address,
+                          const RangeT& range,
+                          const codable::EncodingOptions& options = {})
+    {
+        auto encoded_object = codable::EncodedObjectPool::acquire();
+        codable::encode_batch(range, *encoded_object, options);
+        await_send(instance_id, port_address, *encoded_object);
+    }
+
+    /**
+     * @brief Coalesce small sends headed to the same instance
+     *
+     * Encoded objects whose serialized descriptors fit in max_batch_bytes are packed with other small sends to the
+     * same instance into a single tagged message. The message is issued when it is full or window after its first
+     * object was added, whichever comes first; await_send returns once the coalesced message completes. A window of
+     * zero disables coalescing.
+     */
+    void set_send_coalescing(std::chrono::microseconds window, std::size_t max_batch_bytes = 8192);
+
+    /**
+     * @brief Send an EncodedObject to the PortAddress at InstanceID without awaiting completion
+     *
+     * The Client takes ownership of encoded_object and holds it until the send completes. At most send_window() sends
+     * per instance are in flight; when the window is full the calling fiber yields until the progress engine retires a
+     * completion. The returned future is satisfied, or holds the send error, when the send completes.
+     *
+     * Async sends are issued individually and do not participate in send coalescing.
+     */
+    Future<void> async_send(const InstanceID& instance_id,
+                            const PortAddress& port_address,
+                            std::unique_ptr<codable::EncodedObject> encoded_object);
+
+    /**
+     * @brief Maximum number of async_send operations in flight per instance
+     */
+    std::size_t send_window() const;
+
+    void set_send_window(std::size_t max_in_flight);
+
+    /**
+     * @brief Yield until all async_send operations to instance_id have completed
+     */
+    void await_async_sends(const InstanceID& instance_id);
+
     // number of established remote instances
     std::size_t connections() const;
 
@@ -90,6 +152,25 @@ class Client final : public Service
     void push_request(void* request);
 
   private:
+    struct CoalescedBatch;
+    struct InFlightSend;
+
+    std::shared_ptr<SendWindow> window_for(const InstanceID& instance_id);
+
+    // completes an async_send: satisfies the caller's future, returns the window slot and releases the encoded object
+    static void async_send_completion_handler(void* request, ucs_status_t status, void* user_data);
+
+    // window and max_batch_bytes are the coalescing settings sampled by await_send under m_coalesce_mutex
+    void await_send_coalesced(const InstanceID& instance_id,
+                              const PortAddress& port_address,
+                              const codable::EncodedObject& encoded_object,
+                              std::size_t bytes,
+                              std::chrono::microseconds window,
+                              std::size_t max_batch_bytes);
+
+    // issue the tagged send of a sealed batch; completion is signaled on the batch's promise
+    void send_batch(InstanceID instance_id, CoalescedBatch& batch);
+
     void do_service_start() final;
     void do_service_await_live() final;
     void do_service_stop() final;
@@ -102,6 +183,18 @@ class Client final : public Service
 
     std::map<InstanceID, ucx::WorkerAddress> m_workers;
     mutable std::map<InstanceID, std::shared_ptr<ucx::Endpoint>> m_endpoints;
+
+    // open coalesced batch per instance and the coalescing settings; guarded by m_coalesce_mutex
+    Mutex m_coalesce_mutex;
+    std::map<InstanceID, std::shared_ptr<CoalescedBatch>> m_open_batches;
+    std::chrono::microseconds m_coalesce_window{0};
+    std::size_t m_coalesce_max_bytes{8192};
+
+    // per instance in-flight accounting for async_send; slots are released by the send completion handler which runs
+    // on the progress engine; m_send_window and m_send_windows are guarded by m_send_windows_mutex
+    std::map<InstanceID, std::shared_ptr<SendWindow>> m_send_windows;
+    mutable Mutex m_send_windows_mutex;
+    std::size_t m_send_window{64};
 };
 
 }  // namespace srf::internal::data_plane
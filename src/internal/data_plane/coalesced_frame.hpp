@@ -0,0 +1,89 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/exceptions/runtime_error.hpp>
+#include <srf/types.hpp>
+#include <srf/utils/little_endian.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// a coalesced message packs the serialized descriptors of many encoded objects headed to the same instance into a
+// single tagged send; each record is
+//
+//   port_address  8 bytes
+//   bytes         4 bytes
+//   payload       bytes
+//
+// header fields are little-endian regardless of the host byte order
+
+namespace srf::internal::data_plane::coalesced {
+
+static constexpr std::size_t record_header_bytes = sizeof(std::uint64_t) + sizeof(std::uint32_t);
+
+inline std::size_t record_bytes(std::size_t payload_bytes)
+{
+    return record_header_bytes + payload_bytes;
+}
+
+/**
+ * @brief Append a record to frame; returns a pointer to the payload region of payload_bytes to be filled by the caller
+ */
+inline std::uint8_t* append_record(std::vector<std::uint8_t>& frame,
+                                   PortAddress port_address,
+                                   std::size_t payload_bytes)
+{
+    auto offset = frame.size();
+    frame.resize(offset + record_bytes(payload_bytes));
+    utils::little_endian::store<std::uint64_t>(frame.data() + offset, port_address);
+    utils::little_endian::store<std::uint32_t>(frame.data() + offset + sizeof(std::uint64_t),
+                                               static_cast<std::uint32_t>(payload_bytes));
+    return frame.data() + offset + record_header_bytes;
+}
+
+/**
+ * @brief Invoke on_record(port_address, const void* payload, std::size_t bytes) for each record of a received frame
+ */
+template <typename FunctionT>
+void for_each_record(const void* data, std::size_t bytes, FunctionT&& on_record)
+{
+    const auto* ptr = static_cast<const std::uint8_t*>(data);
+    const auto* end = ptr + bytes;
+
+    while (ptr != end)
+    {
+        if (static_cast<std::size_t>(end - ptr) < record_header_bytes)
+        {
+            throw exceptions::SrfRuntimeError("coalesced message: truncated record header");
+        }
+        const auto address       = utils::little_endian::load<std::uint64_t>(ptr);
+        const auto payload_bytes = utils::little_endian::load<std::uint32_t>(ptr + sizeof(std::uint64_t));
+        ptr += record_header_bytes;
+
+        if (static_cast<std::size_t>(end - ptr) < payload_bytes)
+        {
+            throw exceptions::SrfRuntimeError("coalesced message: truncated record payload");
+        }
+        on_record(static_cast<PortAddress>(address), ptr, payload_bytes);
+        ptr += payload_bytes;
+    }
+}
+
+}  // namespace srf::internal::data_plane::coalesced
@@ -0,0 +1,105 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/types.hpp>
+
+#include <glog/logging.h>
+
+#include <cstddef>
+#include <mutex>
+
+namespace srf::internal::data_plane {
+
+/**
+ * @brief Bounds the number of in-flight operations to a single remote instance
+ *
+ * acquire yields the calling fiber while the window is full; release is called from the completion path, typically on
+ * the progress engine, and wakes any waiters. The limit and the in-flight count are both guarded by the window's
+ * mutex so a limit change is observed by fibers already waiting on the window.
+ */
+class SendWindow
+{
+  public:
+    explicit SendWindow(std::size_t limit) : m_limit(limit)
+    {
+        CHECK_GT(m_limit, 0);
+    }
+
+    /**
+     * @brief Yield until an in-flight slot is available, then take it
+     */
+    void acquire()
+    {
+        std::unique_lock<Mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_in_flight < m_limit; });
+        ++m_in_flight;
+    }
+
+    /**
+     * @brief Return a slot taken by acquire
+     */
+    void release()
+    {
+        {
+            std::lock_guard<Mutex> lock(m_mutex);
+            DCHECK_GT(m_in_flight, 0);
+            --m_in_flight;
+        }
+        m_cv.notify_all();
+    }
+
+    /**
+     * @brief Yield until no slots are held
+     */
+    void await_idle()
+    {
+        std::unique_lock<Mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_in_flight == 0; });
+    }
+
+    void set_limit(std::size_t limit)
+    {
+        CHECK_GT(limit, 0);
+        {
+            std::lock_guard<Mutex> lock(m_mutex);
+            m_limit = limit;
+        }
+        m_cv.notify_all();
+    }
+
+    std::size_t limit() const
+    {
+        std::lock_guard<Mutex> lock(m_mutex);
+        return m_limit;
+    }
+
+    std::size_t in_flight() const
+    {
+        std::lock_guard<Mutex> lock(m_mutex);
+        return m_in_flight;
+    }
+
+  private:
+    mutable Mutex m_mutex;
+    CondV m_cv;
+    std::size_t m_limit;
+    std::size_t m_in_flight{0};
+};
+
+}  // namespace srf::internal::data_plane
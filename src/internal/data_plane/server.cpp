@@ -17,6 +17,7 @@
 
 #include "internal/data_plane/server.hpp"
 
+#include "internal/data_plane/coalesced_frame.hpp"
 #include "internal/data_plane/tags.hpp"
 
 #include <srf/channel/status.hpp>
@@ -47,6 +48,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <ostream>
 #include <utility>
@@ -82,6 +84,31 @@ void recv_completion_handler(void* request, ucs_status_t status, const ucp_tag_r
     ucp_request_free(request);
 }
 
+void coalesced_recv_completion_handler(void* request,
+                                       ucs_status_t status,
+                                       const ucp_tag_recv_info_t* msg_info,
+                                       void* user_data)
+{
+    if (status != UCS_OK)
+    {
+        LOG(FATAL) << "coalesced_recv_completion_handler observed " << ucs_status_string(status);
+    }
+    DCHECK(static_subscriber && static_subscriber->is_subscribed());
+
+    // each record is copied into its own allocation so downstream ownership of an ingress block is the same whether
+    // or not the sender coalesced it
+    coalesced::for_each_record(
+        user_data, msg_info->length, [](PortAddress port_address, const void* data, std::size_t bytes) {
+            void* copy = std::malloc(bytes);
+            std::memcpy(copy, data, bytes);
+            auto msg = std::make_pair(port_address, memory::block(copy, bytes, memory::memory_kind_type::host));
+            static_subscriber->on_next(std::move(msg));
+        });
+
+    std::free(user_data);
+    ucp_request_free(request);
+}
+
 }  // namespace
 
 Server::Server(std::shared_ptr<ucx::Context> context, std::shared_ptr<resources::PartitionResources> resources) :
@@ -235,6 +262,16 @@ void DataPlaneServerWorker::on_tagged_msg(rxcpp::subscriber<network_event_t>& su
         params.cb.recv   = recv_completion_handler;
         break;
     }
+    case COALESCED_TAG: {
+        params.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_USER_DATA | UCP_OP_ATTR_FIELD_RECV_INFO |
+                              UCP_OP_ATTR_FLAG_NO_IMM_CMPL;
+
+        recv_bytes       = msg_info.length;
+        recv_addr        = std::malloc(recv_bytes);
+        params.user_data = recv_addr;
+        params.cb.recv   = coalesced_recv_completion_handler;
+        break;
+    }
     case DESCRIPTOR_TAG:
         // m_rd_source.await_write(msg_info.sender_tag);
         // m_descriptors_channel->await_write(msg_info.sender_tag);
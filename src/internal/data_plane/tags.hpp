@@ -33,6 +33,7 @@ static constexpr ucp_tag_t MSG_TYPE_MASK  = 0xF000000000000000;  // leading 4 bi
 static constexpr ucp_tag_t INGRESS_TAG    = 0x8000000000000000;  // leading 4 bits are 1000  // NOLINT
 static constexpr ucp_tag_t DESCRIPTOR_TAG = 0x4000000000000000;  // leading 4 bits are 0100  // NOLINT
 static constexpr ucp_tag_t FUTURE_TAG     = 0x2000000000000000;  // leading 4 bits are 0010  // NOLINT
+static constexpr ucp_tag_t COALESCED_TAG  = 0x1000000000000000;  // leading 4 bits are 0001  // NOLINT
 
 static constexpr ucp_tag_t USR_TYPE_MASK = 0x0000FFFFFFFFFFFF;  // 48-bits  // NOLINT
 
@@ -70,7 +71,7 @@ static std::tuple<ucp_tag_t, ucp_tag_t, std::uint8_t, std::uint32_t> tag_decode(
 // 0x8 = node id send/recv
 // 0x4 = obj id dec/[inc]
 // 0x2 = future / promise
-// 0x1 = unused
+// 0x1 = coalesced node id send/recv
 
 // 0x08 = unused
 // 0x04 = unused
@@ -0,0 +1,287 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/pipeline/autoscaler.hpp"
+
+#include "internal/pipeline/manager.hpp"
+#include "internal/pipeline/pipeline.hpp"
+#include "internal/segment/definition.hpp"
+
+#include "srf/core/addresses.hpp"
+#include "srf/exceptions/runtime_error.hpp"
+#include "srf/segment/utils.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <utility>
+
+namespace srf::internal::pipeline {
+
+namespace {
+constexpr std::uint32_t DefaultEvaluationPeriodMs = 1000;
+constexpr double DefaultScaleUpPressure           = 0.1;
+constexpr double DefaultScaleDownUtilization      = 0.5;
+constexpr std::uint32_t DefaultScaleDownPeriods   = 5;
+}  // namespace
+
+ScalingPolicy::ScalingPolicy(const protos::ScalingOptions& options) :
+  m_min_count(std::max<std::size_t>(options.min_count(), 1)),
+  m_max_count(options.max_count()),
+  m_initial_count(options.initial_count()),
+  m_evaluation_period(options.evaluation_period_ms() > 0 ? options.evaluation_period_ms() : DefaultEvaluationPeriodMs),
+  m_scale_up_pressure(options.scale_up_pressure() > 0.0 ? options.scale_up_pressure() : DefaultScaleUpPressure),
+  m_scale_down_utilization(options.scale_down_utilization() > 0.0 ? options.scale_down_utilization()
+                                                                   : DefaultScaleDownUtilization),
+  m_scale_down_periods(options.scale_down_periods() > 0 ? options.scale_down_periods() : DefaultScaleDownPeriods)
+{
+    CHECK(options.strategy() == protos::ScalingOptions::Dynamic) << "ScalingPolicy requires the Dynamic strategy";
+
+    // segment::Definition::set_options rejects these first; repeated here for policies built from raw options
+    if (m_max_count < m_min_count)
+    {
+        throw exceptions::SrfRuntimeError("dynamic scaling requires max_count >= max(min_count, 1)");
+    }
+    if (m_scale_down_utilization > 1.0)
+    {
+        throw exceptions::SrfRuntimeError("dynamic scaling requires scale_down_utilization <= 1.0");
+    }
+}
+
+std::size_t ScalingPolicy::min_count() const
+{
+    return m_min_count;
+}
+
+std::size_t ScalingPolicy::max_count() const
+{
+    return m_max_count;
+}
+
+std::size_t ScalingPolicy::initial_count() const
+{
+    return clamp(m_initial_count);
+}
+
+std::chrono::milliseconds ScalingPolicy::evaluation_period() const
+{
+    return m_evaluation_period;
+}
+
+std::size_t ScalingPolicy::clamp(std::size_t count) const
+{
+    return std::clamp(count, m_min_count, m_max_count);
+}
+
+std::size_t ScalingPolicy::evaluate(const ScalingSample& sample)
+{
+    if (sample.instances == 0)
+    {
+        return initial_count();
+    }
+
+    if (sample.pressure >= m_scale_up_pressure)
+    {
+        // the observed rate is what the current instances sustain while saturated
+        m_capacity_per_instance = sample.rate / sample.instances;
+        m_quiet_periods         = 0;
+        return clamp(sample.instances + 1);
+    }
+
+    bool underutilized = false;
+    if (m_capacity_per_instance > 0.0)
+    {
+        auto reduced_capacity = m_capacity_per_instance * (sample.instances - 1) * m_scale_down_utilization;
+        underutilized         = sample.rate <= reduced_capacity;
+    }
+    else
+    {
+        underutilized = sample.rate == 0.0;
+    }
+
+    if (!underutilized || sample.instances <= m_min_count)
+    {
+        m_quiet_periods = 0;
+        return clamp(sample.instances);
+    }
+
+    if (++m_quiet_periods < m_scale_down_periods)
+    {
+        return clamp(sample.instances);
+    }
+
+    m_quiet_periods = 0;
+    return clamp(sample.instances - 1);
+}
+
+Autoscaler::Autoscaler(Manager& manager,
+                       const std::map<SegmentID, protos::ScalingOptions>& options,
+                       std::size_t partition_count) :
+  m_manager(manager),
+  m_partition_count(partition_count)
+{
+    CHECK_GT(m_partition_count, 0);
+
+    for (const auto& [id, scaling_options] : options)
+    {
+        if (scaling_options.strategy() != protos::ScalingOptions::Dynamic)
+        {
+            continue;
+        }
+
+        const auto& definition = m_manager.pipeline().find_segment(id);
+        auto input_ports       = definition->ingress_port_names();
+        if (input_ports.empty())
+        {
+            LOG(WARNING) << "segment " << definition->name()
+                         << " has no ingress ports; dynamic scaling requires input pressure - ignoring";
+            continue;
+        }
+
+        ScalingPolicy policy(scaling_options);
+        m_period = std::min(m_period, policy.evaluation_period());
+        m_policies.emplace(id, std::move(policy));
+        m_input_ports[id] = std::move(input_ports);
+    }
+}
+
+void Autoscaler::run(runnable::Context& ctx)
+{
+    if (m_policies.empty())
+    {
+        return;
+    }
+
+    DVLOG(10) << info(ctx) << ": evaluating " << m_policies.size() << " segments every " << m_period.count() << "ms";
+
+    std::unique_lock<Mutex> lock(m_mutex);
+    while (state() == State::Run)
+    {
+        lock.unlock();
+        evaluate();
+        lock.lock();
+
+        m_cv.wait_for(lock, m_period, [this] { return state() != State::Run; });
+    }
+
+    DVLOG(10) << info(ctx) << ": autoscaler complete";
+}
+
+void Autoscaler::on_state_update(const State& state)
+{
+    if (state == State::Stop || state == State::Kill)
+    {
+        std::lock_guard<Mutex> lock(m_mutex);
+        m_cv.notify_all();
+    }
+}
+
+void Autoscaler::evaluate()
+{
+    auto assignments = m_manager.current_assignments();
+    if (assignments.empty())
+    {
+        // nothing is running until the first update is pushed
+        return;
+    }
+
+    auto stats   = m_manager.manifold_statistics();
+    auto now     = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double>(now - m_last_evaluation).count();
+    bool initial = !std::exchange(m_initialized, true);
+    bool changed = false;
+
+    for (auto& [id, policy] : m_policies)
+    {
+        std::set<SegmentRank> ranks;
+        for (const auto& [address, partition] : assignments)
+        {
+            auto [segment_id, rank] = segment_address_decode(address);
+            if (segment_id == id)
+            {
+                ranks.insert(rank);
+            }
+        }
+
+        std::size_t desired = 0;
+        if (initial)
+        {
+            auto bounded = std::clamp(ranks.size(), policy.min_count(), policy.max_count());
+            desired      = std::max(policy.initial_count(), bounded);
+        }
+        else
+        {
+            std::size_t writes         = 0;
+            std::size_t blocked_writes = 0;
+            for (const auto& name : m_input_ports.at(id))
+            {
+                auto current = stats.find(name);
+                if (current == stats.end())
+                {
+                    continue;
+                }
+                const auto& previous = m_last_stats[name];
+                writes += current->second.writes - previous.writes;
+                blocked_writes += current->second.blocked_writes - previous.blocked_writes;
+            }
+
+            ScalingSample sample;
+            sample.instances = ranks.size();
+            sample.pressure  = (writes > 0 ? static_cast<double>(blocked_writes) / writes : 0.0);
+            sample.rate      = (elapsed > 0.0 ? writes / elapsed : 0.0);
+            desired          = policy.evaluate(sample);
+
+            DVLOG(10) << "autoscaler: segment " << id << " instances=" << sample.instances
+                      << "; pressure=" << sample.pressure << "; rate=" << sample.rate << "; desired=" << desired;
+        }
+
+        // add instances using the lowest unused ranks; assign partitions round-robin by rank
+        for (SegmentRank rank = 0; ranks.size() < desired; ++rank)
+        {
+            if (ranks.count(rank) == 0)
+            {
+                ranks.insert(rank);
+                assignments[segment_address_encode(id, rank)] = rank % m_partition_count;
+                changed                                        = true;
+            }
+        }
+
+        // retire the highest ranks first
+        while (ranks.size() > desired)
+        {
+            auto rank = *ranks.rbegin();
+            ranks.erase(rank);
+            assignments.erase(segment_address_encode(id, rank));
+            changed = true;
+        }
+    }
+
+    m_last_stats      = std::move(stats);
+    m_last_evaluation = now;
+
+    if (changed)
+    {
+        VLOG(10) << "autoscaler: issuing segment assignment update";
+        m_manager.push_updates(std::move(assignments));
+    }
+}
+
+}  // namespace srf::internal::pipeline
@@ -0,0 +1,126 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "internal/pipeline/types.hpp"
+
+#include <srf/manifold/interface.hpp>
+#include <srf/protos/architect.pb.h>
+#include <srf/runnable/context.hpp>
+#include <srf/runnable/forward.hpp>
+#include <srf/runnable/runnable.hpp>
+#include <srf/types.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace srf::internal::pipeline {
+
+class Manager;
+
+/**
+ * @brief Load observed on the inputs of a segment over a single evaluation period
+ */
+struct ScalingSample
+{
+    // number of running instances of the segment
+    std::size_t instances{0};
+
+    // fraction of hand-offs to the segment which found every input channel full
+    double pressure{0.0};
+
+    // objects handed to the segment per second
+    double rate{0.0};
+};
+
+/**
+ * @brief Computes the desired instance count of a segment configured with the Dynamic ScalingStrategy.
+ *
+ * An instance is added whenever the input pressure exceeds the scale-up threshold. While under pressure, the
+ * per-instance capacity is estimated from the observed rate; an instance is removed only after the input rate could
+ * have been served by one fewer instance at the scale-down utilization for the configured number of consecutive
+ * periods. Until a capacity estimate exists, instances are only removed when the segment receives no data.
+ */
+class ScalingPolicy final
+{
+  public:
+    /**
+     * @throws exceptions::SrfRuntimeError if max_count < max(min_count, 1) or scale_down_utilization > 1
+     */
+    ScalingPolicy(const protos::ScalingOptions& options);
+
+    std::size_t min_count() const;
+    std::size_t max_count() const;
+    std::size_t initial_count() const;
+    std::chrono::milliseconds evaluation_period() const;
+
+    std::size_t evaluate(const ScalingSample& sample);
+
+  private:
+    std::size_t clamp(std::size_t count) const;
+
+    std::size_t m_min_count;
+    std::size_t m_max_count;
+    std::size_t m_initial_count;
+    std::chrono::milliseconds m_evaluation_period;
+    double m_scale_up_pressure;
+    double m_scale_down_utilization;
+    std::size_t m_scale_down_periods;
+
+    double m_capacity_per_instance{0.0};
+    std::size_t m_quiet_periods{0};
+};
+
+/**
+ * @brief Periodically samples the manifolds feeding each dynamically scaled segment and issues segment assignment
+ * updates through Manager::push_updates when the desired instance counts change.
+ *
+ * Launched by the Manager when a segment definition's options request the Dynamic scaling strategy. Evaluation begins
+ * once the first segment assignments have been pushed.
+ */
+class Autoscaler final : public runnable::RunnableWithContext<>
+{
+  public:
+    Autoscaler(Manager& manager,
+               const std::map<SegmentID, protos::ScalingOptions>& options,
+               std::size_t partition_count);
+    ~Autoscaler() final = default;
+
+  private:
+    void run(runnable::Context& ctx) final;
+    void on_state_update(const State& state) final;
+
+    void evaluate();
+
+    Manager& m_manager;
+    const std::size_t m_partition_count;
+    std::chrono::milliseconds m_period{std::chrono::milliseconds::max()};
+    std::map<SegmentID, ScalingPolicy> m_policies;
+    std::map<SegmentID, std::vector<PortName>> m_input_ports;
+    std::map<PortName, manifold::EgressStatistics> m_last_stats;
+    std::chrono::steady_clock::time_point m_last_evaluation;
+    bool m_initialized{false};
+
+    Mutex m_mutex;
+    CondV m_cv;
+};
+
+}  // namespace srf::internal::pipeline
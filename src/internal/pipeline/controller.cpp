@@ -144,6 +144,11 @@ void Controller::update(SegmentAddresses&& new_segments_map)
     VLOG(10) << info() << ": update complete";
 }
 
+std::map<PortName, manifold::EgressStatistics> Controller::manifold_statistics() const
+{
+    return m_pipeline->manifold_statistics();
+}
+
 void Controller::did_complete()
 {
     VLOG(10) << info() << ": received shutdown notification - channel closed no new assigments will be issued";
@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <srf/manifold/interface.hpp>
 #include <srf/node/generic_sink.hpp>
+#include <srf/types.hpp>
 
 #include "internal/pipeline/instance.hpp"
 #include "internal/pipeline/types.hpp"
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -34,6 +37,8 @@ class Controller final : public node::GenericSink<ControlMessage>
 
     void await_on_pipeline() const;
 
+    std::map<PortName, manifold::EgressStatistics> manifold_statistics() const;
+
   private:
     void on_data(ControlMessage&& message) final;
     void did_complete() final;
@@ -27,6 +27,7 @@
 #include "srf/core/addresses.hpp"
 #include "srf/core/task_queue.hpp"
 #include "srf/manifold/interface.hpp"
+#include "srf/metrics/registry.hpp"
 #include "srf/segment/utils.hpp"
 #include "srf/types.hpp"
 
@@ -34,6 +35,8 @@
 #include <boost/fiber/future/future.hpp>
 
 #include <exception>
+#include <map>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -48,11 +51,21 @@ Instance::Instance(std::shared_ptr<const Pipeline> definition,
 {
     CHECK(m_definition);
     m_joinable_future = m_joinable_promise.get_future().share();
+
+    // the registry is owned by this instance, so the collector can not outlive it
+    metrics_registry().add_collector([this] { export_manifold_metrics(); });
 }
 
 void Instance::update()
 {
-    for (const auto& [name, manifold] : m_manifolds)
+    // manifold updates may yield; iterate over a snapshot rather than holding the lock
+    std::map<PortName, std::shared_ptr<manifold::Interface>> manifolds;
+    {
+        std::lock_guard<decltype(m_manifolds_mutex)> lock(m_manifolds_mutex);
+        manifolds = m_manifolds;
+    }
+
+    for (const auto& [name, manifold] : manifolds)
     {
         manifold->update_inputs();
         manifold->update_outputs();
@@ -91,7 +104,7 @@ void Instance::stop_segment(const SegmentAddress& address)
     for (const auto& name : segdef->ingress_port_names())
     {
         DVLOG(3) << "Dropping IngressPort for " << ::srf::segment::info(address) << " on manifold " << name;
-        // manifold(name).drop_output(address);
+        manifold(name).drop_output(address);
     }
 
     search->second->service_stop();
@@ -113,6 +126,9 @@ void Instance::create_segment(const SegmentAddress& address, std::uint32_t parti
             auto definition = m_definition->find_segment(id);
             auto segment    = std::make_unique<segment::Instance>(definition, rank, *this, partition_id);
 
+            // manifolds use the host partition of each attached segment to prefer numa-local hand-offs
+            auto& host_resources = partition(partition_id).host();
+
             for (const auto& name : definition->egress_port_names())
             {
                 VLOG(10) << ::srf::segment::info(address) << " configuring manifold for egress port " << name;
@@ -120,9 +136,10 @@ void Instance::create_segment(const SegmentAddress& address, std::uint32_t parti
                 if (!manifold)
                 {
                     VLOG(10) << ::srf::segment::info(address) << " creating manifold for egress port " << name;
-                    manifold          = segment->create_manifold(name);
-                    m_manifolds[name] = manifold;
+                    manifold = segment->create_manifold(name);
+                    add_manifold(name, manifold);
                 }
+                manifold->set_segment_resources(address, host_resources);
                 segment->attach_manifold(manifold);
             }
 
@@ -133,9 +150,10 @@ void Instance::create_segment(const SegmentAddress& address, std::uint32_t parti
                 if (!manifold)
                 {
                     VLOG(10) << ::srf::segment::info(address) << " creating manifold for ingress port " << name;
-                    manifold          = segment->create_manifold(name);
-                    m_manifolds[name] = manifold;
+                    manifold = segment->create_manifold(name);
+                    add_manifold(name, manifold);
                 }
+                manifold->set_segment_resources(address, host_resources);
                 segment->attach_manifold(manifold);
             }
 
@@ -153,6 +171,7 @@ manifold::Interface& Instance::manifold(const PortName& port_name)
 
 std::shared_ptr<manifold::Interface> Instance::get_manifold(const PortName& port_name)
 {
+    std::lock_guard<decltype(m_manifolds_mutex)> lock(m_manifolds_mutex);
     auto search = m_manifolds.find(port_name);
     if (search == m_manifolds.end())
     {
@@ -162,6 +181,45 @@ std::shared_ptr<manifold::Interface> Instance::get_manifold(const PortName& port
     return m_manifolds.at(port_name);
 }
 
+void Instance::add_manifold(const PortName& port_name, std::shared_ptr<manifold::Interface> manifold)
+{
+    std::lock_guard<decltype(m_manifolds_mutex)> lock(m_manifolds_mutex);
+    CHECK(manifold);
+    m_manifolds[port_name] = std::move(manifold);
+}
+
+std::map<PortName, manifold::EgressStatistics> Instance::manifold_statistics() const
+{
+    std::map<PortName, manifold::EgressStatistics> stats;
+    std::lock_guard<decltype(m_manifolds_mutex)> lock(m_manifolds_mutex);
+    for (const auto& [name, manifold] : m_manifolds)
+    {
+        stats[name] = manifold->egress_statistics();
+    }
+    return stats;
+}
+
+void Instance::export_manifold_metrics()
+{
+    auto& registry = metrics_registry();
+    std::lock_guard<decltype(m_exported_statistics_mutex)> lock(m_exported_statistics_mutex);
+    for (const auto& [name, stats] : manifold_statistics())
+    {
+        auto& last = m_exported_statistics[name];
+        std::map<std::string, std::string> labels{{"port", name}};
+
+        registry.make_counter("srf_manifold_local_writes_total", labels)
+            .increment(stats.local_writes - last.local_writes);
+        registry.make_counter("srf_manifold_remote_writes_total", labels)
+            .increment(stats.remote_writes - last.remote_writes);
+        registry.make_counter("srf_manifold_blocked_writes_total", labels)
+            .increment(stats.blocked_writes - last.blocked_writes);
+        registry.make_gauge("srf_manifold_outputs", labels).set(static_cast<double>(stats.outputs));
+
+        last = stats;
+    }
+}
+
 void Instance::mark_joinable()
 {
     if (!m_joinable)
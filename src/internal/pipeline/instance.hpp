@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace srf::internal::pipeline {
 
@@ -56,6 +57,11 @@ class Instance final : public Service, public Resources
      */
     void update();
 
+    /**
+     * @brief Snapshot of the egress counters of each manifold keyed by port name; safe to call from any thread
+     */
+    std::map<PortName, manifold::EgressStatistics> manifold_statistics() const;
+
   private:
     void do_service_start() final;
     void do_service_await_live() final;
@@ -65,13 +71,21 @@ class Instance final : public Service, public Resources
 
     void mark_joinable();
 
+    // metrics collector; exports the egress counters of every manifold to the pipeline's metrics registry
+    void export_manifold_metrics();
+
     manifold::Interface& manifold(const PortName& port_name);
     std::shared_ptr<manifold::Interface> get_manifold(const PortName& port_name);
+    void add_manifold(const PortName& port_name, std::shared_ptr<manifold::Interface> manifold);
 
     std::shared_ptr<const Pipeline> m_definition;  // convert to pipeline::Pipeline
 
     std::map<SegmentAddress, std::unique_ptr<segment::Instance>> m_segments;
     std::map<PortName, std::shared_ptr<manifold::Interface>> m_manifolds;
+    mutable std::mutex m_manifolds_mutex;
+
+    std::map<PortName, manifold::EgressStatistics> m_exported_statistics;
+    std::mutex m_exported_statistics_mutex;
 
     bool m_joinable{false};
     Promise<void> m_joinable_promise;
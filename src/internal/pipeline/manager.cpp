@@ -16,12 +16,14 @@
  */
 
 #include "internal/pipeline/manager.hpp"
+#include "internal/pipeline/autoscaler.hpp"
 #include "internal/pipeline/controller.hpp"
 #include "internal/pipeline/instance.hpp"
 #include "internal/pipeline/pipeline.hpp"
 #include "internal/resources/host_resources.hpp"
 #include "internal/resources/partition_resources.hpp"
 #include "internal/resources/resource_partitions.hpp"
+#include "internal/segment/definition.hpp"
 #include "srf/internal/pipeline/ipipeline.hpp"
 #include "srf/node/edge_builder.hpp"
 #include "srf/node/source_channel.hpp"
@@ -32,6 +34,7 @@
 #include <glog/logging.h>
 
 #include <exception>
+#include <map>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -56,11 +59,53 @@ Manager::~Manager()
 
 void Manager::push_updates(SegmentAddresses&& segment_addresses)
 {
+    // serialize updates from the user and the autoscaler so the recorded assignments match the last issued update
+    std::lock_guard<Mutex> lock(m_update_mutex);
     CHECK(m_update_channel);
 
+    m_current_assignments = segment_addresses;
     m_update_channel->await_write({ControlMessageType::Update, std::move(segment_addresses)});
 }
 
+SegmentAddresses Manager::current_assignments() const
+{
+    std::lock_guard<Mutex> lock(m_update_mutex);
+    return m_current_assignments;
+}
+
+std::map<PortName, manifold::EgressStatistics> Manager::manifold_statistics() const
+{
+    CHECK(m_controller);
+    return m_controller->runnable_as<Controller>().manifold_statistics();
+}
+
+void Manager::start_autoscaler()
+{
+    std::map<SegmentID, protos::ScalingOptions> options;
+    for (const auto& [id, definition] : m_pipeline->segments())
+    {
+        const auto& scaling = definition->options().scaling_options();
+        if (scaling.strategy() == protos::ScalingOptions::Dynamic)
+        {
+            options[id] = scaling;
+        }
+    }
+
+    if (options.empty())
+    {
+        return;
+    }
+
+    runnable::LaunchOptions main;
+    main.engine_factory_name = "main";
+    main.pe_count            = 1;
+    main.engines_per_pe      = 1;
+
+    auto autoscaler = std::make_unique<Autoscaler>(*this, options, resources().partitions());
+    auto launcher   = resources().partition(0).host().launch_control().prepare_launcher(main, std::move(autoscaler));
+    m_autoscaler    = launcher->ignition();
+}
+
 void Manager::do_service_start()
 {
     runnable::LaunchOptions main;
@@ -88,6 +133,8 @@ void Manager::do_service_start()
         });
     });
     m_controller = launcher->ignition();
+
+    start_autoscaler();
 }
 
 void Manager::do_service_await_live()
@@ -97,12 +144,22 @@ void Manager::do_service_await_live()
 
 void Manager::do_service_stop()
 {
+    if (m_autoscaler)
+    {
+        VLOG(10) << "stop: stopping autoscaler";
+        m_autoscaler->stop();
+        m_autoscaler->await_join();
+    }
     VLOG(10) << "stop: closing update channels";
     m_update_channel->await_write({ControlMessageType::Stop});
 }
 
 void Manager::do_service_kill()
 {
+    if (m_autoscaler)
+    {
+        m_autoscaler->kill();
+    }
     VLOG(10) << "kill: closing update channels; issuing kill to controllers";
     m_update_channel->await_write({ControlMessageType::Kill});
 }
@@ -117,6 +174,11 @@ void Manager::do_service_await_join()
     {
         ptr = std::current_exception();
     }
+    if (m_autoscaler)
+    {
+        m_autoscaler->stop();
+        m_autoscaler->await_join();
+    }
     m_update_channel.reset();
     m_controller->await_join();
     if (ptr)
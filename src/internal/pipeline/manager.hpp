@@ -23,8 +23,13 @@
 #include "internal/service.hpp"
 #include "srf/channel/status.hpp"
 #include "srf/node/source_channel.hpp"
+#include "srf/manifold/interface.hpp"
 #include "srf/runnable/runner.hpp"
+#include "srf/types.hpp"
 
+#include <srf/protos/architect.pb.h>
+
+#include <map>
 #include <memory>
 
 namespace srf::internal::pipeline {
@@ -46,10 +51,28 @@ class Manager : public Service
 
     void push_updates(SegmentAddresses&& segment_addresses);
 
+    /**
+     * @brief The most recent set of segment assignments issued via push_updates
+     */
+    SegmentAddresses current_assignments() const;
+
+    /**
+     * @brief Snapshot of the egress counters of the manifolds of the running pipeline
+     */
+    std::map<PortName, manifold::EgressStatistics> manifold_statistics() const;
+
   protected:
     resources::ResourcePartitions& resources();
 
   private:
+    /**
+     * @brief Launch an Autoscaler if any segment definition requests the Dynamic scaling strategy
+     *
+     * Segments with the Static strategy keep the instance counts issued via push_updates. Dynamic segments are
+     * brought to their initial count on the first evaluation after an update has been pushed.
+     */
+    void start_autoscaler();
+
     void do_service_start() final;
     void do_service_await_live() final;
     void do_service_stop() final;
@@ -60,6 +83,9 @@ class Manager : public Service
     std::shared_ptr<Pipeline> m_pipeline;
     std::unique_ptr<node::SourceChannelWriteable<ControlMessage>> m_update_channel;
     std::unique_ptr<runnable::Runner> m_controller;
+    std::unique_ptr<runnable::Runner> m_autoscaler;
+    SegmentAddresses m_current_assignments;
+    mutable Mutex m_update_mutex;
 };
 
 }  // namespace srf::internal::pipeline
@@ -26,7 +26,10 @@ namespace srf::internal::pipeline {
 Resources::Resources(std::shared_ptr<resources::ResourcePartitions> resources) :
   m_resources(std::move(resources)),
   m_metrics_registry(std::make_unique<metrics::Registry>())
-{}
+{
+    CHECK(m_resources);
+    m_resources->register_metrics(*m_metrics_registry);
+}
 resources::ResourcePartitions& Resources::resources() const
 {
     DCHECK(m_resources);
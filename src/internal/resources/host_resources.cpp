@@ -22,13 +22,21 @@
 #include "internal/runnable/engine_factory.hpp"
 #include "internal/system/engine_factory_cpu_sets.hpp"
 #include "internal/system/system.hpp"
+#include "srf/codable/memory_resources.hpp"
 #include "srf/core/bitmap.hpp"
+#include "srf/exceptions/runtime_error.hpp"
+#include "srf/memory/adaptors.hpp"
+#include "srf/memory/resources/arena_resource.hpp"
+#include "srf/memory/resources/host/numa_memory_resource.hpp"
 #include "srf/runnable/types.hpp"
 #include "srf/types.hpp"
 
 #include <glog/logging.h>
+#include <hwloc.h>
 #include <boost/fiber/future/future.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
 #include <ostream>
 #include <string>
@@ -37,8 +45,54 @@
 
 namespace srf::internal::resources {
 
-HostResources::HostResources(std::shared_ptr<system::System> system, const system::HostPartition& partition) :
-  m_partition(partition)
+namespace {
+
+// partition-local host memory mapped up front; the arena grows by superblocks up to the memory of the numa nodes
+constexpr std::size_t host_arena_initial_bytes = 64UL << 20;
+
+std::size_t numa_memory_bytes(hwloc_topology_t topology, const NumaSet& numa_set)
+{
+    std::size_t bytes = 0;
+    numa_set.for_each_bit([&](std::uint32_t /*index*/, std::uint32_t os_index) {
+        auto* node = hwloc_get_numanode_obj_by_os_index(topology, os_index);
+        if (node != nullptr)
+        {
+            bytes += node->attr->numanode.local_memory;
+        }
+    });
+    // the arena requires sizes which are multiples of 256 bytes
+    return std::max(bytes & ~std::size_t{255}, host_arena_initial_bytes);
+}
+
+}  // namespace
+
+PartitionMemoryResources::PartitionMemoryResources(std::shared_ptr<host_memory_resource_t> host) :
+  m_host(std::move(host)),
+  m_host_view(m_host)
+{
+    CHECK(m_host);
+}
+
+PartitionMemoryResources::host_view_t PartitionMemoryResources::host_resource_view()
+{
+    return m_host_view;
+}
+
+PartitionMemoryResources::device_view_t PartitionMemoryResources::device_resource_view()
+{
+    throw exceptions::SrfRuntimeError("device memory resources are not yet available to host partitions");
+}
+
+const std::shared_ptr<host_memory_resource_t>& PartitionMemoryResources::host_resource() const
+{
+    return m_host;
+}
+
+HostResources::HostResources(std::shared_ptr<system::System> system,
+                             const system::HostPartition& partition,
+                             std::size_t host_partition_id) :
+  m_partition(partition),
+  m_host_partition_id(host_partition_id)
 {
     DVLOG(10) << "constructing main task queue for host partition " << partition.cpu_set().str();
     auto search = partition.engine_factory_cpu_sets().fiber_cpu_sets.find("main");
@@ -54,20 +108,22 @@ HostResources::HostResources(std::shared_ptr<system::System> system, const syste
 
             for (const auto& [name, cpu_set] : partition.engine_factory_cpu_sets().fiber_cpu_sets)
             {
-                auto reusable = partition.engine_factory_cpu_sets().is_resuable(name);
+                auto reusable  = partition.engine_factory_cpu_sets().is_resuable(name);
+                auto placement = partition.engine_factory_cpu_sets().placement(name);
                 DVLOG(10) << "fiber engine factory: " << name << " using " << cpu_set.str() << " is "
                           << (reusable ? "resuable" : "not reusable");
                 config.resource_groups[name] =
-                    runnable::make_engine_factory(system, runnable::EngineType::Fiber, cpu_set, reusable);
+                    runnable::make_engine_factory(system, runnable::EngineType::Fiber, cpu_set, reusable, placement);
             }
 
             for (const auto& [name, cpu_set] : partition.engine_factory_cpu_sets().thread_cpu_sets)
             {
-                auto reusable = partition.engine_factory_cpu_sets().is_resuable(name);
+                auto reusable  = partition.engine_factory_cpu_sets().is_resuable(name);
+                auto placement = partition.engine_factory_cpu_sets().placement(name);
                 DVLOG(10) << "thread engine factory: " << name << " using " << cpu_set.str() << " is "
                           << (reusable ? "resuable" : "not reusable");
                 config.resource_groups[name] =
-                    runnable::make_engine_factory(system, runnable::EngineType::Thread, cpu_set, reusable);
+                    runnable::make_engine_factory(system, runnable::EngineType::Thread, cpu_set, reusable, placement);
             }
 
             // construct launch control
@@ -75,10 +131,27 @@ HostResources::HostResources(std::shared_ptr<system::System> system, const syste
             m_launch_control = std::make_shared<::srf::runnable::LaunchControl>(std::move(config));
 
             // construct host memory resource
+            auto numa_set = partition.numa_set();
+            if (numa_set.empty())
+            {
+                numa_set = system->topology().numaset_for_cpuset(partition.cpu_set());
+            }
             DVLOG(10) << "constructing memory_resource on main for host partition " << partition.cpu_set().str()
-                      << " - not yet implemeted";
+                      << " bound to " << numa_set;
+            auto topology      = system->topology().handle();
+            auto maximum_bytes = numa_memory_bytes(topology, numa_set);
+            auto numa          = std::make_shared<memory::numa_memory_resource>(topology, std::move(numa_set));
+
+            // allocations on the encode path are served from the arena; only superblocks are mapped and bound
+            m_memory_resource =
+                memory::make_shared_resource<memory::arena_resource>(numa, host_arena_initial_bytes, maximum_bytes);
         })
         .get();
+
+    // encoded objects created on any thread of the partition allocate their host buffers from the partition's memory
+    DVLOG(10) << "registering thread local memory resources for host partition " << partition.cpu_set().str();
+    system->register_thread_local_resource<codable::MemoryResources>(
+        partition.cpu_set(), std::make_shared<PartitionMemoryResources>(m_memory_resource));
 }
 
 core::FiberTaskQueue& HostResources::main()
@@ -97,4 +170,16 @@ const system::HostPartition& HostResources::partition() const
 {
     return m_partition;
 }
+
+std::size_t HostResources::host_partition_id() const
+{
+    return m_host_partition_id;
+}
+
+std::shared_ptr<host_memory_resource_t> HostResources::memory_resource() const
+{
+    CHECK(m_memory_resource);
+    return m_memory_resource;
+}
+
 }  // namespace srf::internal::resources
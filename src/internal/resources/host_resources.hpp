@@ -19,27 +19,68 @@
 
 #include "internal/system/forward.hpp"
 #include "internal/system/host_partition.hpp"
+#include "srf/codable/memory_resources.hpp"
 #include "srf/core/task_queue.hpp"
+#include "srf/memory/resources/arena_resource.hpp"
+#include "srf/memory/resources/host/numa_memory_resource.hpp"
 #include "srf/pipeline/resources.hpp"
 #include "srf/runnable/launch_control.hpp"
 
+#include <cstddef>
 #include <memory>
 
 namespace srf::internal::resources {
 
+// partition-local host memory: an arena sub-allocating from NUMA-bound pages
+using host_memory_resource_t = memory::arena_resource<std::shared_ptr<memory::numa_memory_resource>>;
+
+/**
+ * @brief codable::MemoryResources registered as the thread local resource of every thread in a host partition
+ */
+class PartitionMemoryResources final : public codable::MemoryResources
+{
+  public:
+    PartitionMemoryResources(std::shared_ptr<host_memory_resource_t> host);
+    ~PartitionMemoryResources() final = default;
+
+    host_view_t host_resource_view() final;
+    device_view_t device_resource_view() final;
+
+    const std::shared_ptr<host_memory_resource_t>& host_resource() const;
+
+  private:
+    std::shared_ptr<host_memory_resource_t> m_host;
+    host_view_t m_host_view;
+};
+
 class HostResources : public ::srf::pipeline::Resources
 {
   public:
-    HostResources(std::shared_ptr<system::System> system, const system::HostPartition& partition);
+    HostResources(std::shared_ptr<system::System> system,
+                  const system::HostPartition& partition,
+                  std::size_t host_partition_id);
 
     const system::HostPartition& partition() const;
     ::srf::core::FiberTaskQueue& main() final;
     ::srf::runnable::LaunchControl& launch_control() final;
+    std::size_t host_partition_id() const final;
+
+    /**
+     * @brief Host memory resource bound to the NUMA node(s) of the partition
+     *
+     * An arena over a numa_memory_resource: pages are bound and mapped in superblocks, while individual allocations
+     * are served from per-thread arenas without a system call. Registered as the thread local codable::MemoryResources
+     * host view of every thread in the partition, so that the host buffers of EncodedObjects are allocated
+     * partition-local.
+     */
+    std::shared_ptr<host_memory_resource_t> memory_resource() const;
 
   private:
     const system::HostPartition& m_partition;
+    const std::size_t m_host_partition_id;
     std::shared_ptr<::srf::core::FiberTaskQueue> m_main;
     std::shared_ptr<::srf::runnable::LaunchControl> m_launch_control;
+    std::shared_ptr<host_memory_resource_t> m_memory_resource;
 };
 
 }  // namespace srf::internal::resources
@@ -42,7 +42,7 @@ SystemResources::SystemResources(std::shared_ptr<System> system) : m_system(std:
         // Launch Control
         // Host Memory Resource (not yet implemented)
         // Block Memory Cache
-        auto host_resources = std::make_shared<HostResources>(m_system, partition);
+        auto host_resources = std::make_shared<HostResources>(m_system, partition, m_host_resources.size());
         m_host_resources.push_back(host_resources);
 
         for (const auto& device_partition_id : partition.device_partition_ids())
@@ -66,6 +66,11 @@ const std::vector<std::shared_ptr<DeviceResources>>& SystemResources::device_res
     return m_device_resources;
 }
 
+void SystemResources::register_metrics(metrics::Registry& registry) const
+{
+    system().register_metrics(registry);
+}
+
 system::System& SystemResources::system() const
 {
     DCHECK(m_system);
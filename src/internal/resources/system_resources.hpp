@@ -25,6 +25,10 @@
 #include <utility>
 #include <vector>
 
+namespace srf::metrics {
+class Registry;
+}  // namespace srf::metrics
+
 namespace srf::internal::resources {
 
 using system::System;
@@ -40,6 +44,11 @@ class SystemResources
     const std::vector<std::shared_ptr<HostResources>>& host_resources() const;
     const std::vector<std::shared_ptr<DeviceResources>>& device_resources() const;
 
+    /**
+     * @brief export system level metrics, e.g. fiber scheduler statistics, to registry
+     */
+    void register_metrics(metrics::Registry& registry) const;
+
   protected:
     System& system() const;
 
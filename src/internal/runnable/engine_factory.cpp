@@ -20,10 +20,13 @@
 #include "internal/runnable/fiber_engines.hpp"
 #include "internal/runnable/thread_engines.hpp"
 #include "internal/system/fiber_pool.hpp"
+#include "internal/system/pinned_thread_pool.hpp"
 #include "internal/system/system.hpp"
+#include "internal/utils/ranges.hpp"
 #include "srf/constants.hpp"
 #include "srf/core/task_queue.hpp"
 #include "srf/exceptions/runtime_error.hpp"
+#include "srf/options/engine_groups.hpp"
 #include "srf/runnable/engine.hpp"
 #include "srf/runnable/engine_factory.hpp"
 #include "srf/runnable/launch_options.hpp"
@@ -31,7 +34,10 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -41,6 +47,25 @@ namespace srf::internal::runnable {
 class FiberEngineFactory : public ::srf::runnable::EngineFactory
 {
   public:
+    /**
+     * @param cpu_order - logical cpus of cpu_set in the order they are handed out to engines
+     */
+    FiberEngineFactory(const system::System& system,
+                       const CpuSet& cpu_set,
+                       const std::vector<std::uint32_t>& cpu_order) :
+      m_pool(system.make_fiber_pool(cpu_set))
+    {
+        // the queues of the pool are indexed by the position of their logical cpu in the bitmap order of cpu_set
+        const auto cpus = cpu_set.vec();
+        for (const auto& cpu : cpu_order)
+        {
+            auto search = std::find(cpus.begin(), cpus.end(), cpu);
+            CHECK(search != cpus.end()) << "logical cpu " << cpu << " is not part of the fiber pool";
+            m_queue_order.push_back(std::distance(cpus.begin(), search));
+        }
+        CHECK_EQ(m_queue_order.size(), m_pool->thread_count());
+    }
+
     /**
      * @brief FiberEngines will be build on N pes/threads with fibers per thread equivalent to engines_per_pe.
      *
@@ -51,8 +76,10 @@ class FiberEngineFactory : public ::srf::runnable::EngineFactory
      */
     std::shared_ptr<::srf::runnable::Engines> build_engines(const LaunchOptions& launch_options) final
     {
-        return std::make_shared<FiberEngines>(
-            launch_options, get_next_n_queues(launch_options.pe_count), SRF_DEFAULT_FIBER_PRIORITY);
+        FiberMetaData meta;
+        meta.priority = SRF_DEFAULT_FIBER_PRIORITY;
+        meta.deadline = launch_options.deadline;
+        return std::make_shared<FiberEngines>(launch_options, get_next_n_queues(launch_options.pe_count), meta);
     }
 
     ::srf::runnable::EngineType backend() const final
@@ -60,8 +87,25 @@ class FiberEngineFactory : public ::srf::runnable::EngineFactory
         return EngineType::Fiber;
     }
 
+  protected:
+    std::size_t thread_count() const
+    {
+        return m_queue_order.size();
+    }
+
+    /**
+     * @brief task queue of the n-th logical cpu in placement order
+     */
+    std::shared_ptr<core::FiberTaskQueue> queue(std::size_t n) const
+    {
+        return m_pool->task_queue_shared(m_queue_order.at(n));
+    }
+
   private:
     virtual std::vector<std::shared_ptr<core::FiberTaskQueue>> get_next_n_queues(std::size_t count) = 0;
+
+    std::shared_ptr<system::FiberPool> m_pool;
+    std::vector<std::size_t> m_queue_order;
 };
 
 /**
@@ -70,19 +114,21 @@ class FiberEngineFactory : public ::srf::runnable::EngineFactory
 class ReusableFiberEngineFactory final : public FiberEngineFactory
 {
   public:
-    ReusableFiberEngineFactory(std::shared_ptr<system::System> system, const CpuSet& cpu_set) :
-      m_pool(system->make_fiber_pool(cpu_set))
+    ReusableFiberEngineFactory(const system::System& system,
+                               const CpuSet& cpu_set,
+                               const std::vector<std::uint32_t>& cpu_order) :
+      FiberEngineFactory(system, cpu_set, cpu_order)
     {}
     ~ReusableFiberEngineFactory() final = default;
 
     std::vector<std::shared_ptr<core::FiberTaskQueue>> get_next_n_queues(std::size_t count) final
     {
-        DCHECK_LE(count, m_pool->thread_count());
+        DCHECK_LE(count, thread_count());
         std::vector<std::shared_ptr<core::FiberTaskQueue>> queues;
 
         for (int i = 0; i < count; ++i)
         {
-            queues.push_back(m_pool->task_queue_shared(next()));
+            queues.push_back(queue(next()));
         }
 
         return std::move(queues);
@@ -92,14 +138,13 @@ class ReusableFiberEngineFactory final : public FiberEngineFactory
     std::size_t next()
     {
         auto n = m_offset++;
-        if (m_offset == m_pool->thread_count())
+        if (m_offset == thread_count())
         {
             m_offset = 0;
         }
         return n;
     }
 
-    std::shared_ptr<system::FiberPool> m_pool;
     std::size_t m_offset{0};
 };
 
@@ -109,15 +154,17 @@ class ReusableFiberEngineFactory final : public FiberEngineFactory
 class SingleUseFiberEngineFactory final : public FiberEngineFactory
 {
   public:
-    SingleUseFiberEngineFactory(std::shared_ptr<system::System> system, const CpuSet& cpu_set) :
-      m_pool(system->make_fiber_pool(cpu_set))
+    SingleUseFiberEngineFactory(const system::System& system,
+                                const CpuSet& cpu_set,
+                                const std::vector<std::uint32_t>& cpu_order) :
+      FiberEngineFactory(system, cpu_set, cpu_order)
     {}
     ~SingleUseFiberEngineFactory() final = default;
 
   protected:
     std::vector<std::shared_ptr<core::FiberTaskQueue>> get_next_n_queues(std::size_t count) final
     {
-        if (m_offset + count > m_pool->thread_count())
+        if (m_offset + count > thread_count())
         {
             LOG(ERROR) << "more dedicated threads/cores than available";
             throw exceptions::SrfRuntimeError("more dedicated threads/cores than available");
@@ -127,31 +174,38 @@ class SingleUseFiberEngineFactory final : public FiberEngineFactory
 
         for (int i = 0; i < count; ++i)
         {
-            queues.push_back(m_pool->task_queue_shared(m_offset + i));
+            queues.push_back(queue(m_offset + i));
         }
 
         return std::move(queues);
     }
 
   private:
-    std::shared_ptr<system::FiberPool> m_pool;
     std::size_t m_offset{0};
 };
 class ThreadEngineFactory : public ::srf::runnable::EngineFactory
 {
   public:
-    ThreadEngineFactory(std::shared_ptr<system::System> system, CpuSet cpu_set) :
-      m_system(std::move(system)),
-      m_cpu_set(std::move(cpu_set))
+    /**
+     * @param cpu_order - logical cpus of cpu_set in the order they are handed out to engines
+     */
+    ThreadEngineFactory(std::shared_ptr<system::System> system, CpuSet cpu_set, std::vector<std::uint32_t> cpu_order) :
+      m_cpu_set(std::move(cpu_set)),
+      m_cpu_order(std::move(cpu_order)),
+      m_pool(std::make_shared<system::PinnedThreadPool>(std::move(system)))
     {
         CHECK(!m_cpu_set.empty());
-        CHECK(m_system);
+        CHECK_EQ(m_cpu_order.size(), m_cpu_set.weight());
     }
 
+    /**
+     * @brief ThreadEngines built by this factory share a pool of pinned threads, so the threads of completed
+     * runnables are reused by subsequent launches on the same logical cpus.
+     */
     std::shared_ptr<::srf::runnable::Engines> build_engines(const LaunchOptions& launch_options) final
     {
         auto cpu_set = get_next_n_cpus(launch_options.pe_count);
-        return std::make_shared<ThreadEngines>(launch_options, std::move(cpu_set), m_system);
+        return std::make_shared<ThreadEngines>(launch_options, std::move(cpu_set), m_pool);
     }
 
   protected:
@@ -160,6 +214,14 @@ class ThreadEngineFactory : public ::srf::runnable::EngineFactory
         return m_cpu_set;
     }
 
+    /**
+     * @brief n-th logical cpu in placement order
+     */
+    std::uint32_t cpu(std::size_t n) const
+    {
+        return m_cpu_order.at(n);
+    }
+
     EngineType backend() const final
     {
         return EngineType::Thread;
@@ -169,7 +231,8 @@ class ThreadEngineFactory : public ::srf::runnable::EngineFactory
     virtual CpuSet get_next_n_cpus(std::size_t count) = 0;
 
     CpuSet m_cpu_set;
-    std::shared_ptr<system::System> m_system;
+    std::vector<std::uint32_t> m_cpu_order;
+    std::shared_ptr<system::PinnedThreadPool> m_pool;
 };
 
 /**
@@ -178,8 +241,10 @@ class ThreadEngineFactory : public ::srf::runnable::EngineFactory
 class ReusableThreadEngineFactory final : public ThreadEngineFactory
 {
   public:
-    ReusableThreadEngineFactory(std::shared_ptr<system::System> system, const CpuSet& cpu_set) :
-      ThreadEngineFactory(std::move(system), cpu_set)
+    ReusableThreadEngineFactory(std::shared_ptr<system::System> system,
+                                const CpuSet& cpu_set,
+                                std::vector<std::uint32_t> cpu_order) :
+      ThreadEngineFactory(std::move(system), cpu_set, std::move(cpu_order))
     {}
 
   protected:
@@ -188,25 +253,26 @@ class ReusableThreadEngineFactory final : public ThreadEngineFactory
         CpuSet cpu_set;
         for (int i = 0; i < count; ++i)
         {
-            m_prev_cpu_idx = this->cpu_set().next(m_prev_cpu_idx);
-            if (m_prev_cpu_idx == -1)
+            cpu_set.on(cpu(m_offset));
+            if (++m_offset == this->cpu_set().weight())
             {
-                m_prev_cpu_idx = this->cpu_set().next(m_prev_cpu_idx);
+                m_offset = 0;
             }
-            cpu_set.on(m_prev_cpu_idx);
         }
         return cpu_set;
     }
 
   private:
-    int m_prev_cpu_idx = -1;
+    std::size_t m_offset{0};
 };
 
 class SingleUseThreadEngineFactory final : public ThreadEngineFactory
 {
   public:
-    SingleUseThreadEngineFactory(std::shared_ptr<system::System> system, const CpuSet& cpu_set) :
-      ThreadEngineFactory(std::move(system), cpu_set)
+    SingleUseThreadEngineFactory(std::shared_ptr<system::System> system,
+                                 const CpuSet& cpu_set,
+                                 std::vector<std::uint32_t> cpu_order) :
+      ThreadEngineFactory(std::move(system), cpu_set, std::move(cpu_order))
     {}
 
   protected:
@@ -215,42 +281,61 @@ class SingleUseThreadEngineFactory final : public ThreadEngineFactory
         CpuSet cpu_set;
         for (int i = 0; i < count; ++i)
         {
-            m_prev_cpu_idx = this->cpu_set().next(m_prev_cpu_idx);
-            if (m_prev_cpu_idx == -1)
+            if (m_offset == this->cpu_set().weight())
             {
                 LOG(ERROR) << "SingleUse logical cpu ids exhausted";
                 throw exceptions::SrfRuntimeError("SingleUse logical cpu ids exhausted");
             }
-            cpu_set.on(m_prev_cpu_idx);
+            cpu_set.on(cpu(m_offset++));
         }
         return cpu_set;
     }
 
   private:
-    int m_prev_cpu_idx = -1;
+    std::size_t m_offset{0};
 };
 
+namespace {
+
+std::vector<std::uint32_t> placement_order(const system::System& system,
+                                           const CpuSet& cpu_set,
+                                           EnginePlacement placement)
+{
+    if (placement == EnginePlacement::SpreadCores)
+    {
+        return system.topology().core_spread_order(cpu_set);
+    }
+    return cpu_set.vec();
+}
+
+}  // namespace
+
 std::shared_ptr<::srf::runnable::EngineFactory> make_engine_factory(std::shared_ptr<system::System> system,
                                                                     EngineType engine_type,
                                                                     const CpuSet& cpu_set,
-                                                                    bool reusable)
+                                                                    bool reusable,
+                                                                    EnginePlacement placement)
 {
+    auto cpu_order = placement_order(*system, cpu_set, placement);
+    DVLOG(10) << "engine factory placement order for " << cpu_set.str() << ": "
+              << print_ranges(find_ranges(cpu_order));
+
     if (engine_type == EngineType::Fiber)
     {
         if (reusable)
         {
-            return std::make_shared<ReusableFiberEngineFactory>(system, cpu_set);
+            return std::make_shared<ReusableFiberEngineFactory>(*system, cpu_set, cpu_order);
         }
-        return std::make_shared<SingleUseFiberEngineFactory>(system, cpu_set);
+        return std::make_shared<SingleUseFiberEngineFactory>(*system, cpu_set, cpu_order);
     }
 
     if (engine_type == EngineType::Thread)
     {
         if (reusable)
         {
-            return std::make_shared<ReusableThreadEngineFactory>(std::move(system), cpu_set);
+            return std::make_shared<ReusableThreadEngineFactory>(std::move(system), cpu_set, std::move(cpu_order));
         }
-        return std::make_shared<SingleUseThreadEngineFactory>(std::move(system), cpu_set);
+        return std::make_shared<SingleUseThreadEngineFactory>(std::move(system), cpu_set, std::move(cpu_order));
     }
 
     LOG(FATAL) << "unsupported engine type";
@@ -22,6 +22,7 @@
 #include "internal/runnable/engines.hpp"
 #include "internal/system/forward.hpp"
 #include "srf/core/bitmap.hpp"
+#include "srf/options/engine_groups.hpp"
 #include "srf/runnable/types.hpp"
 
 #include <memory>
@@ -31,6 +32,7 @@ namespace srf::internal::runnable {
 std::shared_ptr<::srf::runnable::EngineFactory> make_engine_factory(std::shared_ptr<system::System> system,
                                                                     EngineType engine_type,
                                                                     const CpuSet& cpu_set,
-                                                                    bool reusable);
+                                                                    bool reusable,
+                                                                    EnginePlacement placement);
 
 }  // namespace srf::internal::runnable
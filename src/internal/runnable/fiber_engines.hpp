@@ -48,6 +48,10 @@ class FiberEngines final : public Engines
                  std::vector<std::shared_ptr<core::FiberTaskQueue>>&& task_queues,
                  int priority = SRF_DEFAULT_FIBER_PRIORITY);
 
+    FiberEngines(::srf::runnable::LaunchOptions launch_options,
+                 std::vector<std::shared_ptr<core::FiberTaskQueue>>&& task_queues,
+                 const FiberMetaData& meta);
+
     ~FiberEngines() final = default;
 
     EngineType engine_type() const final;
@@ -17,37 +17,26 @@
 
 #include "internal/runnable/thread_engine.hpp"
 
-#include "internal/system/system.hpp"
+#include "internal/system/pinned_thread_pool.hpp"
 
+#include <glog/logging.h>
 #include <boost/fiber/future/future.hpp>
-#include <boost/fiber/future/packaged_task.hpp>
 
-#include <type_traits>
 #include <utility>
 
 namespace srf::internal::runnable {
 
-ThreadEngine::ThreadEngine(CpuSet cpu_set, std::shared_ptr<system::System> system) :
+ThreadEngine::ThreadEngine(CpuSet cpu_set, std::shared_ptr<system::PinnedThreadPool> pool) :
   m_cpu_set(std::move(cpu_set)),
-  m_system(std::move(system))
-{}
-
-ThreadEngine::~ThreadEngine()
-{
-    m_thread->join();
-}
-
-std::thread::id ThreadEngine::get_id() const
+  m_pool(std::move(pool))
 {
-    return m_thread->get_id();
+    CHECK_EQ(m_cpu_set.weight(), 1) << "a ThreadEngine must be bound to a single logical cpu";
+    CHECK(m_pool);
 }
 
 Future<void> ThreadEngine::do_launch_task(std::function<void()> task)
 {
-    boost::fibers::packaged_task<void()> pkg_task(std::move(task));
-    auto future = pkg_task.get_future();
-    m_thread    = std::make_unique<std::thread>(m_system->make_thread("thread_engine", m_cpu_set, std::move(pkg_task)));
-    return std::move(future);
+    return m_pool->enqueue(m_cpu_set.first(), std::move(task));
 }
 
 runnable::EngineType ThreadEngine::engine_type() const
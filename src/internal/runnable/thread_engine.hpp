@@ -27,27 +27,29 @@
 
 #include <functional>
 #include <memory>
-#include <thread>
+
+namespace srf::internal::system {
+class PinnedThreadPool;
+}  // namespace srf::internal::system
 
 namespace srf::internal::runnable {
 
+/**
+ * @brief Engine which runs its task on a thread of a PinnedThreadPool pinned to the engine's logical cpu
+ */
 class ThreadEngine final : public Engine
 {
   public:
-    explicit ThreadEngine(CpuSet cpu_set, std::shared_ptr<system::System> system);
-    ~ThreadEngine() final;
+    explicit ThreadEngine(CpuSet cpu_set, std::shared_ptr<system::PinnedThreadPool> pool);
+    ~ThreadEngine() final = default;
 
     EngineType engine_type() const final;
 
-  protected:
-    std::thread::id get_id() const;
-
   private:
     Future<void> do_launch_task(std::function<void()> task) final;
 
     CpuSet m_cpu_set;
-    std::shared_ptr<system::System> m_system;
-    std::unique_ptr<std::thread> m_thread{nullptr};
+    std::shared_ptr<system::PinnedThreadPool> m_pool;
 };
 
 }  // namespace srf::internal::runnable
@@ -40,7 +40,7 @@ void ThreadEngines::initialize_launchers()
         cpu.only(cpu_id);
         for (int i = 0; i < launch_options().engines_per_pe; ++i)
         {
-            add_launcher(std::make_shared<ThreadEngine>(cpu, m_system));
+            add_launcher(std::make_shared<ThreadEngine>(cpu, m_pool));
         }
     });
 }
@@ -50,9 +50,17 @@ ThreadEngines::ThreadEngines(CpuSet cpu_set, std::shared_ptr<system::System> sys
 {}
 
 ThreadEngines::ThreadEngines(LaunchOptions launch_options, CpuSet cpu_set, std::shared_ptr<system::System> system) :
+  ThreadEngines(std::move(launch_options),
+                std::move(cpu_set),
+                std::make_shared<system::PinnedThreadPool>(std::move(system)))
+{}
+
+ThreadEngines::ThreadEngines(LaunchOptions launch_options,
+                             CpuSet cpu_set,
+                             std::shared_ptr<system::PinnedThreadPool> pool) :
   Engines(std::move(launch_options)),
   m_cpu_set(std::move(cpu_set)),
-  m_system(std::move(system))
+  m_pool(std::move(pool))
 {
     initialize_launchers();
 }
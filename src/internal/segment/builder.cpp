@@ -55,7 +55,8 @@ Builder::Builder(std::shared_ptr<const Definition> segdef,
     {
         DVLOG(10) << "constructing egress_port: " << name;
         m_egress_ports[name] = initializer(address);
-        m_objects[name]      = m_egress_ports[name];
+        m_egress_ports[name]->set_encoding_options(definition().egress_encoding_options(name));
+        m_objects[name] = m_egress_ports[name];
     }
 
     definition().initializer_fn()(*this);
@@ -21,6 +21,7 @@
 #include "srf/exceptions/runtime_error.hpp"
 #include "srf/types.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <set>
 #include <utility>
@@ -69,6 +70,29 @@ std::vector<std::string> Definition::egress_port_names() const
     return names;
 }
 
+const protos::SegmentOptions& Definition::options() const
+{
+    return m_options;
+}
+
+void Definition::set_options(protos::SegmentOptions options)
+{
+    m_options = std::move(options);
+    validate_options();
+}
+
+codable::EncodingOptions Definition::egress_encoding_options(const std::string& port_name) const
+{
+    codable::EncodingOptions options;
+    const auto& thresholds = m_options.egress_eager_thresholds();
+    auto search            = thresholds.find(port_name);
+    if (search != thresholds.end())
+    {
+        options.eager_threshold(search->second);
+    }
+    return options;
+}
+
 // namespace srf::internal::segment {
 // Definition::Definition(std::string name,
 //                        std::map<std::string, ingress_initializer_t> ingress_initializers,
@@ -156,6 +180,36 @@ void Definition::validate_ports() const
     }
 }
 
+void Definition::validate_options() const
+{
+    for (const auto& [port_name, threshold] : m_options.egress_eager_thresholds())
+    {
+        if (m_egress_initializers.count(port_name) == 0)
+        {
+            throw exceptions::SrfRuntimeError("segment " + m_name + ": eager threshold set for unknown egress port " +
+                                              port_name);
+        }
+    }
+
+    const auto& scaling = m_options.scaling_options();
+    if (scaling.strategy() != protos::ScalingOptions::Dynamic)
+    {
+        return;
+    }
+
+    // proto3 leaves unset bounds at 0; an unset max_count must not be mistaken for an unbounded range
+    if (scaling.max_count() < std::max<std::uint32_t>(scaling.min_count(), 1))
+    {
+        throw exceptions::SrfRuntimeError("segment " + m_name +
+                                          ": dynamic scaling requires max_count >= max(min_count, 1)");
+    }
+    if (scaling.scale_down_utilization() > 1.0)
+    {
+        throw exceptions::SrfRuntimeError("segment " + m_name +
+                                          ": dynamic scaling requires scale_down_utilization <= 1.0");
+    }
+}
+
 // protos::SegmentDefinition Definition::serialize() const
 // {
 //     protos::SegmentDefinition segment;
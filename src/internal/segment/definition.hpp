@@ -21,6 +21,9 @@
 
 #include "srf/types.hpp"
 
+#include <srf/protos/architect.pb.h>
+#include <srf/codable/encoding_options.hpp>
+
 #include <map>
 #include <string>
 #include <vector>
@@ -40,6 +43,14 @@ class Definition final
     std::vector<std::string> ingress_port_names() const;
     std::vector<std::string> egress_port_names() const;
 
+    const protos::SegmentOptions& options() const;
+    void set_options(protos::SegmentOptions options);
+
+    /**
+     * @brief Encoding options for the objects leaving the egress port port_name, as selected by options()
+     */
+    codable::EncodingOptions egress_encoding_options(const std::string& port_name) const;
+
     const IDefinition::backend_initializer_fn_t& initializer_fn() const
     {
         return m_backend_initializer;
@@ -55,12 +66,14 @@ class Definition final
 
   private:
     void validate_ports() const;
+    void validate_options() const;
 
     std::string m_name;
     SegmentID m_id;
     IDefinition::backend_initializer_fn_t m_backend_initializer;
     std::map<std::string, IDefinition::egress_initializer_t> m_egress_initializers;
     std::map<std::string, IDefinition::ingress_initializer_t> m_ingress_initializers;
+    protos::SegmentOptions m_options;
 };
 
 }  // namespace srf::internal::segment
@@ -31,4 +31,9 @@ IDefinition::IDefinition(std::string name,
 {}
 IDefinition::~IDefinition() = default;
 
+void IDefinition::set_options(const protos::SegmentOptions& options)
+{
+    m_impl->set_options(options);
+}
+
 }  // namespace srf::internal::segment
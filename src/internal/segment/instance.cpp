@@ -93,9 +93,8 @@ const SegmentAddress& Instance::address() const
 void Instance::do_service_start()
 {
     // prepare launchers from m_builder
+    // ingress and egress ports are pass-through operators and do not require launching
     std::map<std::string, std::unique_ptr<runnable::Launcher>> m_launchers;
-    std::map<std::string, std::unique_ptr<runnable::Launcher>> m_egress_launchers;
-    std::map<std::string, std::unique_ptr<runnable::Launcher>> m_ingress_launchers;
 
     auto apply_callback = [this](std::unique_ptr<runnable::Launcher>& launcher, std::string name) {
         launcher->apply([this, n = std::move(name)](runnable::Runner& runner) {
@@ -117,45 +116,15 @@ void Instance::do_service_start()
         apply_callback(m_launchers[name], name);
     }
 
-    for (const auto& [name, node] : m_builder->egress_ports())
-    {
-        DVLOG(10) << info() << " constructing launcher egress port " << name;
-        m_egress_launchers[name] =
-            node->prepare_launcher(m_resources.partition(m_default_partition_id).host().launch_control());
-        apply_callback(m_egress_launchers[name], name);
-    }
-
-    for (const auto& [name, node] : m_builder->ingress_ports())
-    {
-        DVLOG(10) << info() << " constructing launcher ingress port " << name;
-        m_ingress_launchers[name] =
-            node->prepare_launcher(m_resources.partition(m_default_partition_id).host().launch_control());
-        apply_callback(m_ingress_launchers[name], name);
-    }
-
     DVLOG(10) << info() << " issuing start request";
 
-    for (const auto& [name, launcher] : m_egress_launchers)
-    {
-        DVLOG(10) << info() << " launching egress port " << name;
-        m_egress_runners[name] = launcher->ignition();
-    }
-
     for (const auto& [name, launcher] : m_launchers)
     {
         DVLOG(10) << info() << " launching node " << name;
         m_runners[name] = launcher->ignition();
     }
 
-    for (const auto& [name, launcher] : m_ingress_launchers)
-    {
-        DVLOG(10) << info() << " launching ingress port " << name;
-        m_ingress_runners[name] = launcher->ignition();
-    }
-
-    m_egress_launchers.clear();
     m_launchers.clear();
-    m_ingress_launchers.clear();
 
     DVLOG(10) << info() << " start has been initiated; use the is_running future to await on startup";
 }
@@ -164,7 +133,7 @@ void Instance::do_service_stop()
 {
     DVLOG(10) << info() << " issuing stop request";
 
-    // we do not issue stop for port since they are nodes and stop has no effect
+    // ports are pass-through operators; they complete when their upstream connections are released
 
     for (const auto& [name, runner] : m_runners)
     {
@@ -179,45 +148,23 @@ void Instance::do_service_kill()
 {
     DVLOG(10) << info() << " issuing kill request";
 
-    for (const auto& [name, runner] : m_ingress_runners)
-    {
-        DVLOG(10) << info() << " issuing kill for ingress port " << name;
-        runner->kill();
-    }
-
     for (const auto& [name, runner] : m_runners)
     {
         DVLOG(10) << info() << " issuing kill for node " << name;
         runner->kill();
     }
 
-    for (const auto& [name, runner] : m_egress_runners)
-    {
-        DVLOG(10) << info() << " issuing kill for egress port " << name;
-        runner->kill();
-    }
-
     DVLOG(10) << info() << " kill has been initiated; use the is_completed future to await on shutdown";
 }
 
 void Instance::do_service_await_live()
 {
     DVLOG(10) << info() << " await_live started";
-    for (const auto& [name, runner] : m_ingress_runners)
-    {
-        DVLOG(10) << info() << " awaiting on ingress port " << name;
-        runner->await_live();
-    }
     for (const auto& [name, runner] : m_runners)
     {
         DVLOG(10) << info() << " awaiting on  " << name;
         runner->await_live();
     }
-    for (const auto& [name, runner] : m_egress_runners)
-    {
-        DVLOG(10) << info() << " awaiting on egress port " << name;
-        runner->await_live();
-    }
     DVLOG(10) << info() << " join complete";
 }
 
@@ -239,21 +186,11 @@ void Instance::do_service_await_join()
         }
     };
 
-    for (const auto& [name, runner] : m_ingress_runners)
-    {
-        DVLOG(10) << info() << " awaiting on ingress port join to " << name;
-        check(*runner);
-    }
     for (const auto& [name, runner] : m_runners)
     {
         DVLOG(10) << info() << " awaiting on join to " << name;
         check(*runner);
     }
-    for (const auto& [name, runner] : m_egress_runners)
-    {
-        DVLOG(10) << info() << " awaiting on egress port join to " << name;
-        check(*runner);
-    }
     DVLOG(10) << info() << " join complete";
     if (first_exception)
     {
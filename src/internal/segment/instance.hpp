@@ -74,8 +74,6 @@ class Instance final : public Service
     const std::size_t m_default_partition_id;
 
     std::map<std::string, std::unique_ptr<runnable::Runner>> m_runners;
-    std::map<std::string, std::unique_ptr<runnable::Runner>> m_egress_runners;
-    std::map<std::string, std::unique_ptr<runnable::Runner>> m_ingress_runners;
 
     mutable std::mutex m_mutex;
 };
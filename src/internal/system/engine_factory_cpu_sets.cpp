@@ -39,6 +39,16 @@ bool EngineFactoryCpuSets::is_resuable(const std::string& name) const
     return search->second;
 }
 
+EnginePlacement EngineFactoryCpuSets::placement(const std::string& name) const
+{
+    auto search = placements.find(name);
+    if (search == placements.end())
+    {
+        return EnginePlacement::LogicalCpuOrder;
+    }
+    return search->second;
+}
+
 EngineFactoryCpuSets generate_engine_factory_cpu_sets(const Options& options, const CpuSet& cpu_set)
 {
     EngineFactoryCpuSets config;
@@ -162,11 +172,21 @@ EngineFactoryCpuSets generate_engine_factory_cpu_sets(const Options& options, co
     config.reusable[default_engine_factory_name()] = true;
     config.reusable["main"]                        = true;
 
+    config.placements[default_engine_factory_name()] = engine_groups.default_engine_placement();
+
     // get all resources for groups that have overlap disabled
     DVLOG(10) << "allocating logical cpus for non-overlapping pools";
     for (const auto& kv : engine_groups_map)
     {
-        config.reusable[kv.first] = kv.second.reusable;
+        config.reusable[kv.first]   = kv.second.reusable;
+        config.placements[kv.first] = kv.second.placement;
+
+        if (kv.second.busy_poll && kv.second.engine_type == runnable::EngineType::Fiber)
+        {
+            DVLOG(10) << "- fiber threads of `" << kv.first << "` busy poll for " << kv.second.busy_poll_timeout.count()
+                      << "us before blocking";
+            config.busy_poll_timeouts[kv.first] = kv.second.busy_poll_timeout;
+        }
 
         if (!kv.second.allow_overlap)
         {
@@ -18,8 +18,10 @@
 #pragma once
 
 #include <srf/core/bitmap.hpp>
+#include <srf/options/engine_groups.hpp>
 #include <srf/options/options.hpp>
 
+#include <chrono>
 #include <map>
 #include <string>
 
@@ -28,10 +30,13 @@ namespace srf::internal::system {
 struct EngineFactoryCpuSets
 {
     bool is_resuable(const std::string& name) const;
+    EnginePlacement placement(const std::string& name) const;
 
     std::map<std::string, Bitmap> fiber_cpu_sets;
     std::map<std::string, Bitmap> thread_cpu_sets;
     std::map<std::string, bool> reusable;
+    std::map<std::string, EnginePlacement> placements;
+    std::map<std::string, std::chrono::nanoseconds> busy_poll_timeouts;
     Bitmap shared_cpus_set;
     bool shared_cpus_has_fibers{false};
 };
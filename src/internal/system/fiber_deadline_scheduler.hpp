@@ -0,0 +1,216 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "internal/system/fiber_idle_waiter.hpp"
+#include "internal/system/fiber_priority_scheduler.hpp"
+#include "internal/system/fiber_ready_queue.hpp"
+#include "internal/system/fiber_scheduler_stats.hpp"
+
+#include <boost/fiber/algo/algorithm.hpp>
+#include <boost/fiber/context.hpp>
+#include <boost/intrusive/set.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace srf::internal::system {
+
+/**
+ * @brief Ready queue ordered by earliest absolute deadline, then by priority
+ *
+ * Fibers with a relative deadline are held in an intrusive ordered set keyed on (deadline, -priority, arrival), so
+ * insertion and removal are O(log n) without allocation. Fibers without a deadline are treated as having an infinite
+ * deadline: they are only picked when no deadline fiber is ready and are ordered among themselves by a
+ * FiberReadyQueue. Under sustained overload of deadline fibers, fibers without a deadline, including the task queue's
+ * main fiber, will be starved.
+ */
+class FiberDeadlineReadyQueue final
+{
+    struct DeadlineOrder
+    {
+        bool operator()(const FiberPriorityProps& lhs, const FiberPriorityProps& rhs) const
+        {
+            if (lhs.m_deadline != rhs.m_deadline)
+            {
+                return lhs.m_deadline < rhs.m_deadline;
+            }
+            if (lhs.get_priority() != rhs.get_priority())
+            {
+                return lhs.get_priority() > rhs.get_priority();
+            }
+            return lhs.m_sequence < rhs.m_sequence;
+        }
+    };
+
+    using deadline_hook_t = boost::intrusive::member_hook<FiberPriorityProps,
+                                                          boost::intrusive::set_member_hook<>,
+                                                          &FiberPriorityProps::m_deadline_hook>;
+    using deadline_set_t =
+        boost::intrusive::set<FiberPriorityProps, deadline_hook_t, boost::intrusive::compare<DeadlineOrder>>;
+
+  public:
+    FiberDeadlineReadyQueue() = default;
+
+    ~FiberDeadlineReadyQueue()
+    {
+        m_deadlines.clear();
+    }
+
+    /**
+     * @brief enqueue a ready context; fibers with a deadline are due at now + their relative deadline
+     */
+    void push(boost::fibers::context* ctx, FiberPriorityProps& props, std::chrono::steady_clock::time_point now)
+    {
+        if (props.get_relative_deadline() <= std::chrono::nanoseconds::zero())
+        {
+            m_background.push(ctx, props.get_priority());
+            return;
+        }
+        props.m_deadline = now + props.get_relative_deadline();
+        props.m_sequence = m_sequence++;
+        m_deadlines.insert(props);
+    }
+
+    /**
+     * @brief remove and return the context with the earliest deadline, else the highest priority context without a
+     * deadline, or nullptr if empty
+     */
+    boost::fibers::context* pop()
+    {
+        if (!m_deadlines.empty())
+        {
+            auto& props = *m_deadlines.begin();
+            m_deadlines.erase(m_deadlines.begin());
+            return props.get_context();
+        }
+        return m_background.pop();
+    }
+
+    /**
+     * @brief remove a ready context; returns false if the context is not held by this queue
+     */
+    bool remove(boost::fibers::context* ctx, FiberPriorityProps& props)
+    {
+        if (props.m_deadline_hook.is_linked())
+        {
+            m_deadlines.erase(m_deadlines.iterator_to(props));
+            return true;
+        }
+        if (ctx->ready_is_linked())
+        {
+            m_background.remove(ctx);
+            return true;
+        }
+        return false;
+    }
+
+    bool empty() const
+    {
+        return m_deadlines.empty() && m_background.empty();
+    }
+
+    std::size_t size() const
+    {
+        return m_deadlines.size() + m_background.size();
+    }
+
+  private:
+    deadline_set_t m_deadlines;
+    FiberReadyQueue m_background;
+    std::uint64_t m_sequence{0};
+};
+
+/**
+ * @brief Earliest-deadline-first variant of the FiberPriorityScheduler
+ *
+ * Fibers launched with a FiberMetaData::deadline run in order of their absolute deadline, with priority breaking ties;
+ * fibers without a deadline run by priority once no deadline fiber is ready.
+ */
+class FiberDeadlineScheduler : public boost::fibers::algo::algorithm_with_properties<FiberPriorityProps>
+{
+  private:
+    FiberDeadlineReadyQueue m_rqueue;
+    FiberIdleWaiter m_waiter;
+    FiberSchedulerStats* m_stats;
+    FiberRunClock m_clock;
+
+  public:
+    FiberDeadlineScheduler(std::chrono::nanoseconds busy_poll_timeout = std::chrono::nanoseconds::zero(),
+                           FiberSchedulerStats* stats                 = nullptr) :
+      m_waiter(busy_poll_timeout),
+      m_stats(stats)
+    {}
+
+    void awakened(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept final
+    {
+        m_rqueue.push(ctx, props, std::chrono::steady_clock::now());
+    }
+
+    boost::fibers::context* pick_next() noexcept final
+    {
+        auto* ctx = m_rqueue.pop();
+        if (m_stats != nullptr)
+        {
+            if (ctx != nullptr)
+            {
+                m_stats->record_switch(m_rqueue.size());
+                m_clock.resumed(*m_stats, FiberReadyQueue::bucket_index(properties(ctx).get_priority()));
+            }
+            else
+            {
+                m_clock.idle(*m_stats);
+            }
+        }
+        return ctx;
+    }
+
+    bool has_ready_fibers() const noexcept final
+    {
+        return !m_rqueue.empty();
+    }
+
+    void property_change(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept final
+    {
+        // a running or waiting fiber picks up its new deadline or priority the next time it is awakened
+        if (m_rqueue.remove(ctx, props))
+        {
+            awakened(ctx, props);
+        }
+    }
+
+    void suspend_until(std::chrono::steady_clock::time_point const& time_point) noexcept final
+    {
+        if (m_stats == nullptr)
+        {
+            m_waiter.wait_until(time_point);
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        m_waiter.wait_until(time_point);
+        m_stats->record_idle(std::chrono::steady_clock::now() - start);
+    }
+
+    void notify() noexcept final
+    {
+        m_waiter.notify();
+    }
+};
+
+}  // namespace srf::internal::system
@@ -0,0 +1,141 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/system/fiber_idle_waiter.hpp"
+
+#include <glog/logging.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+namespace srf::internal::system {
+
+FiberIdleWaiter::~FiberIdleWaiter()
+{
+    if (thread_local_waiter() == this)
+    {
+        thread_local_waiter() = nullptr;
+    }
+    if (m_event_fd >= 0)
+    {
+        close(m_event_fd);
+    }
+    if (m_epoll_fd >= 0)
+    {
+        close(m_epoll_fd);
+    }
+}
+
+void FiberIdleWaiter::watch(int fd, std::function<void()> on_ready)
+{
+    CHECK_GE(fd, 0);
+    CHECK(on_ready);
+    DCHECK(thread_local_waiter() == this) << "fd watched from a thread which does not own the waiter";
+
+    if (m_epoll_fd < 0)
+    {
+        m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        CHECK_GE(m_epoll_fd, 0) << "epoll_create1 failed: " << std::strerror(errno);
+        m_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        CHECK_GE(m_event_fd, 0) << "eventfd failed: " << std::strerror(errno);
+
+        epoll_event event{};
+        event.events  = EPOLLIN;
+        event.data.fd = m_event_fd;
+        CHECK_EQ(epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_event_fd, &event), 0) << std::strerror(errno);
+    }
+
+    epoll_event event{};
+    event.events  = EPOLLIN;
+    event.data.fd = fd;
+    CHECK_EQ(epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event), 0) << std::strerror(errno);
+
+    m_watchers.emplace_back(fd, std::move(on_ready));
+    m_watched.store(m_watchers.size());
+}
+
+void FiberIdleWaiter::unwatch(int fd)
+{
+    DCHECK(thread_local_waiter() == this) << "fd unwatched from a thread which does not own the waiter";
+    auto it = std::find_if(m_watchers.begin(), m_watchers.end(), [fd](const auto& w) { return w.first == fd; });
+    CHECK(it != m_watchers.end()) << "fd " << fd << " is not watched";
+
+    CHECK_EQ(epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr), 0) << std::strerror(errno);
+    m_watchers.erase(it);
+    m_watched.store(m_watchers.size());
+}
+
+void FiberIdleWaiter::wait_for_events(std::chrono::steady_clock::time_point const& time_point) noexcept
+{
+    // a notify which landed before this point is observed here; one which lands after has written the eventfd, so
+    // epoll_wait returns immediately
+    if (m_flag.exchange(false))
+    {
+        return;
+    }
+
+    int timeout_ms = -1;
+    if ((std::chrono::steady_clock::time_point::max)() != time_point)
+    {
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(time_point - std::chrono::steady_clock::now());
+        timeout_ms     = static_cast<int>(std::max<std::chrono::milliseconds::rep>(remaining.count(), 0));
+    }
+
+    std::array<epoll_event, 16> events;
+    auto count = epoll_wait(m_epoll_fd, events.data(), events.size(), timeout_ms);
+    if (count < 0)
+    {
+        LOG_IF(ERROR, errno != EINTR) << "epoll_wait failed: " << std::strerror(errno);
+        return;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        auto fd = events[i].data.fd;
+        if (fd == m_event_fd)
+        {
+            std::uint64_t value;
+            while (read(m_event_fd, &value, sizeof(value)) > 0) {}
+            continue;
+        }
+        for (const auto& [watched_fd, on_ready] : m_watchers)
+        {
+            if (watched_fd == fd)
+            {
+                on_ready();
+                break;
+            }
+        }
+    }
+    m_flag = false;
+}
+
+void FiberIdleWaiter::signal_event_fd() noexcept
+{
+    std::uint64_t value = 1;
+    auto rc             = write(m_event_fd, &value, sizeof(value));
+    DCHECK_EQ(rc, sizeof(value));
+}
+
+}  // namespace srf::internal::system
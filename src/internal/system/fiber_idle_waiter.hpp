@@ -0,0 +1,175 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <boost/fiber/detail/cpu_relax.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace srf::internal::system {
+
+/**
+ * @brief Parks an idle fiber scheduler thread until notified or until a deadline is reached
+ *
+ * With a non-zero busy poll timeout, the thread first spins on a flag, issuing a cpu relax/pause between polls, for up
+ * to the timeout before it falls back to blocking on a condition variable. A notify() which lands during the spin is
+ * observed without a kernel transition on either side, at the cost of keeping the logical cpu busy while idle.
+ *
+ * Fibers running on the waiter's thread may watch file descriptors. While any descriptor is watched, an idle thread
+ * blocks in epoll on the watched descriptors and an eventfd written by notify(); the handler of a readable descriptor
+ * is invoked on the scheduler thread from within suspend_until and is expected to wake the fiber waiting on it.
+ */
+class FiberIdleWaiter final
+{
+  public:
+    FiberIdleWaiter(std::chrono::nanoseconds busy_poll_timeout = std::chrono::nanoseconds::zero()) :
+      m_busy_poll_timeout(busy_poll_timeout)
+    {
+        thread_local_waiter() = this;
+    }
+
+    ~FiberIdleWaiter();
+
+    FiberIdleWaiter(const FiberIdleWaiter&)            = delete;
+    FiberIdleWaiter& operator=(const FiberIdleWaiter&) = delete;
+
+    /**
+     * @brief The waiter of the fiber scheduler running on the calling thread; nullptr if the thread is not running one
+     * of the srf fiber schedulers
+     */
+    static FiberIdleWaiter* current()
+    {
+        return thread_local_waiter();
+    }
+
+    /**
+     * @brief Invoke on_ready from the idle scheduler when fd becomes readable; must be called on the waiter's thread
+     *
+     * The descriptor is level-triggered, so the handler should wake a fiber which unwatches it or consumes the event.
+     * A fiber which may be migrated by a work stealing scheduler must pin itself (FiberPriorityProps::set_pinned)
+     * between watch and unwatch.
+     */
+    void watch(int fd, std::function<void()> on_ready);
+
+    void unwatch(int fd);
+
+    void wait_until(std::chrono::steady_clock::time_point const& time_point) noexcept
+    {
+        if (m_watched.load() > 0)
+        {
+            wait_for_events(time_point);
+            return;
+        }
+
+        if (m_busy_poll_timeout.count() > 0 && poll_until(time_point))
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lk(m_mtx);
+        if ((std::chrono::steady_clock::time_point::max)() == time_point)
+        {
+            m_cnd.wait(lk, [this]() { return m_flag.load(); });
+        }
+        else
+        {
+            m_cnd.wait_until(lk, time_point, [this]() { return m_flag.load(); });
+        }
+        m_flag = false;
+    }
+
+    void notify() noexcept
+    {
+        m_flag = true;
+
+        // an idle thread with watched descriptors is blocked in epoll rather than on the condition variable
+        if (m_watched.load() > 0)
+        {
+            signal_event_fd();
+        }
+
+        // a polling thread will observe the flag; otherwise it must be woken. if the poller is between its last poll
+        // and blocking, it clears m_polling before re-checking the flag under the mutex, so the wakeup is not lost
+        if (m_polling.load())
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lk(m_mtx);
+        lk.unlock();
+        m_cnd.notify_all();
+    }
+
+  private:
+    static FiberIdleWaiter*& thread_local_waiter()
+    {
+        static thread_local FiberIdleWaiter* waiter = nullptr;
+        return waiter;
+    }
+
+    void wait_for_events(std::chrono::steady_clock::time_point const& time_point) noexcept;
+    void signal_event_fd() noexcept;
+
+    // returns true if notified while polling or if the time_point was reached
+    bool poll_until(std::chrono::steady_clock::time_point const& time_point) noexcept
+    {
+        auto now      = std::chrono::steady_clock::now();
+        auto deadline = (time_point - now > m_busy_poll_timeout) ? now + m_busy_poll_timeout : time_point;
+
+        m_polling = true;
+        while (now < deadline)
+        {
+            // check the clock only every few polls; reading it is more expensive than the flag
+            for (int i = 0; i < 64; ++i)
+            {
+                if (m_flag.exchange(false))
+                {
+                    m_polling = false;
+                    return true;
+                }
+                cpu_relax();
+            }
+            now = std::chrono::steady_clock::now();
+        }
+
+        m_polling = false;
+        return deadline == time_point;
+    }
+
+    const std::chrono::nanoseconds m_busy_poll_timeout;
+    std::atomic<bool> m_flag{false};
+    std::atomic<bool> m_polling{false};
+    std::mutex m_mtx;
+    std::condition_variable m_cnd;
+
+    // watched descriptors are only touched on the waiter's thread; the descriptors backing them are created on the
+    // first watch and live as long as the waiter, since notify() may write the eventfd from any thread
+    std::vector<std::pair<int, std::function<void()>>> m_watchers;
+    std::atomic<std::size_t> m_watched{0};
+    int m_epoll_fd{-1};
+    int m_event_fd{-1};
+};
+
+}  // namespace srf::internal::system
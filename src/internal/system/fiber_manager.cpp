@@ -17,17 +17,153 @@
 
 #include "internal/system/fiber_manager.hpp"
 #include "internal/system/fiber_pool.hpp"
+#include "internal/system/fiber_scheduler_stats.hpp"
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
+#include "internal/system/host_partition.hpp"
+#include "internal/system/partitions.hpp"
 #include "internal/system/system.hpp"
 #include "internal/system/topology.hpp"
 #include "srf/core/bitmap.hpp"
 #include "srf/exceptions/runtime_error.hpp"
+#include "srf/metrics/counter.hpp"
+#include "srf/metrics/gauge.hpp"
+#include "srf/metrics/histogram.hpp"
+#include "srf/metrics/registry.hpp"
 #include "srf/options/fiber_pool.hpp"
 #include "srf/options/options.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace srf::internal::system {
 
+namespace {
+
+/**
+ * @brief Exports the FiberSchedulerStats of a single FiberTaskQueue to a metrics::Registry
+ *
+ * The scheduler stats are monotonic; each update publishes the change since the previous update.
+ */
+class FiberSchedulerMetrics
+{
+  public:
+    FiberSchedulerMetrics(metrics::Registry& registry,
+                          std::uint32_t cpu_id,
+                          std::shared_ptr<const FiberSchedulerStats> stats) :
+      m_registry(registry),
+      m_cpu_id(std::to_string(cpu_id)),
+      m_stats(std::move(stats)),
+      m_context_switches(registry.make_counter("srf_fiber_context_switches_total", {{"cpu_id", m_cpu_id}})),
+      m_idle_periods(registry.make_counter("srf_fiber_idle_periods_total", {{"cpu_id", m_cpu_id}})),
+      m_idle_us(registry.make_counter("srf_fiber_idle_microseconds_total", {{"cpu_id", m_cpu_id}})),
+      m_ready_queue_length(registry.make_gauge("srf_fiber_ready_queue_length", {{"cpu_id", m_cpu_id}})),
+      m_ready_queue_histogram(registry.make_histogram(
+          "srf_fiber_ready_queue_length_at_switch", {{"cpu_id", m_cpu_id}}, bucket_boundaries())),
+      m_idle_histogram(
+          registry.make_histogram("srf_fiber_idle_period_microseconds", {{"cpu_id", m_cpu_id}}, bucket_boundaries()))
+    {
+        CHECK(m_stats);
+    }
+
+    void update()
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        const auto& stats = *m_stats;
+
+        m_context_switches.increment(delta(stats.context_switches, m_last.context_switches));
+        m_idle_periods.increment(delta(stats.idle_periods, m_last.idle_periods));
+
+        auto idle_ns       = stats.idle_ns.load(std::memory_order_relaxed);
+        auto idle_delta_us = static_cast<double>(idle_ns - m_last_idle_ns) / 1000.0;
+        m_idle_us.increment(idle_ns / 1000 - m_last_idle_ns / 1000);
+        m_idle_histogram.observe_multiple(delta(stats.idle_us_histogram, m_last.idle_us_histogram), idle_delta_us);
+        m_last_idle_ns = idle_ns;
+
+        m_ready_queue_length.set(static_cast<double>(stats.ready_queue_length.load(std::memory_order_relaxed)));
+        auto ready_sum = static_cast<double>(delta(stats.ready_queue_length_sum, m_last.ready_queue_length_sum));
+        m_ready_queue_histogram.observe_multiple(
+            delta(stats.ready_queue_length_histogram, m_last.ready_queue_length_histogram), ready_sum);
+
+        for (std::size_t i = 0; i < FiberSchedulerStats::PriorityClasses; ++i)
+        {
+            auto run_ns = stats.run_ns_by_priority[i].load(std::memory_order_relaxed);
+            auto last   = m_last.run_ns_by_priority[i].load(std::memory_order_relaxed);
+            if (run_ns / 1000 == last / 1000)
+            {
+                continue;
+            }
+
+            // only priority classes which have run are exported
+            auto search = m_run_us.find(i);
+            if (search == m_run_us.end())
+            {
+                auto priority = std::to_string(static_cast<int>(i) + SRF_MIN_FIBER_PRIORITY);
+                search        = m_run_us
+                             .emplace(i,
+                                      m_registry.make_counter("srf_fiber_run_microseconds_total",
+                                                              {{"cpu_id", m_cpu_id}, {"priority", priority}}))
+                             .first;
+            }
+            search->second.increment(run_ns / 1000 - last / 1000);
+            m_last.run_ns_by_priority[i].store(run_ns, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    static std::vector<double> bucket_boundaries()
+    {
+        // bucket i of a FiberSchedulerStats histogram holds integer values in [2^(i-1), 2^i)
+        std::vector<double> boundaries;
+        for (std::size_t i = 0; i < FiberSchedulerStats::HistogramBuckets - 1; ++i)
+        {
+            boundaries.push_back(static_cast<double>((std::uint64_t{1} << i) - 1));
+        }
+        return boundaries;
+    }
+
+    static std::uint64_t delta(const FiberSchedulerStats::counter_t& current, FiberSchedulerStats::counter_t& last)
+    {
+        auto value = current.load(std::memory_order_relaxed);
+        auto prev  = last.exchange(value, std::memory_order_relaxed);
+        return value - prev;
+    }
+
+    static std::vector<double> delta(const FiberSchedulerStats::histogram_t& current,
+                                     FiberSchedulerStats::histogram_t& last)
+    {
+        std::vector<double> increments;
+        increments.reserve(current.size());
+        for (std::size_t i = 0; i < current.size(); ++i)
+        {
+            increments.push_back(static_cast<double>(delta(current[i], last[i])));
+        }
+        return increments;
+    }
+
+    metrics::Registry& m_registry;
+    const std::string m_cpu_id;
+    const std::shared_ptr<const FiberSchedulerStats> m_stats;
+    FiberSchedulerStats m_last;
+    std::uint64_t m_last_idle_ns{0};
+
+    metrics::Counter m_context_switches;
+    metrics::Counter m_idle_periods;
+    metrics::Counter m_idle_us;
+    metrics::Gauge m_ready_queue_length;
+    metrics::Histogram m_ready_queue_histogram;
+    metrics::Histogram m_idle_histogram;
+    std::map<std::size_t, metrics::Counter> m_run_us;
+    std::mutex m_mutex;
+};
+
+}  // namespace
+
 FiberManager::FiberManager(const System& system) : m_cpu_set(system.topology().cpu_set())
 {
     auto cpu_count = system.topology().cpu_set().weight();
@@ -35,10 +171,67 @@ FiberManager::FiberManager(const System& system) : m_cpu_set(system.topology().c
     VLOG(1) << "creating fiber task queues on " << cpu_count << " threads";
     VLOG(1) << "thread_binding : " << (system.options().fiber_pool().enable_thread_binding() ? " TRUE" : "FALSE");
     VLOG(1) << "memory_binding : " << (system.options().fiber_pool().enable_memory_binding() ? " TRUE" : "FALSE");
+    VLOG(1) << "work_stealing  : " << (system.options().fiber_pool().enable_work_stealing() ? " TRUE" : "FALSE");
+    VLOG(1) << "telemetry      : " << (system.options().fiber_pool().enable_scheduler_telemetry() ? " TRUE" : "FALSE");
+
+    VLOG(1) << "deadlines      : " << (system.options().fiber_pool().enable_deadline_scheduling() ? " TRUE" : "FALSE");
+
+    if (system.options().fiber_pool().enable_work_stealing() &&
+        system.options().fiber_pool().enable_deadline_scheduling())
+    {
+        LOG(ERROR) << "fiber pool work stealing and deadline scheduling are mutually exclusive";
+        throw exceptions::SrfRuntimeError("fiber pool work stealing and deadline scheduling are mutually exclusive");
+    }
+
+    if (system.options().fiber_pool().enable_work_stealing())
+    {
+        // one stealing slot per logical cpu, tagged with its numa node so local peers are preferred victims
+        std::vector<std::uint32_t> numa_ids;
+        system.topology().cpu_set().for_each_bit([&](std::int32_t idx, std::int32_t cpu_id) {
+            numa_ids.push_back(system.topology().numaset_for_cpuset(CpuSet(cpu_id)).first());
+        });
+        m_steal_group = std::make_shared<FiberWorkStealingGroup>(std::move(numa_ids));
+    }
+
+    // logical cpus of fiber engine groups with busy polling enabled; a cpu shared by several groups polls for the
+    // longest of their timeouts
+    std::map<std::uint32_t, std::chrono::nanoseconds> busy_poll_timeouts;
+    for (const auto& partition : system.partitions().host_partitions())
+    {
+        const auto& cpu_sets = partition.engine_factory_cpu_sets();
+        for (const auto& [name, timeout] : cpu_sets.busy_poll_timeouts)
+        {
+            auto search = cpu_sets.fiber_cpu_sets.find(name);
+            CHECK(search != cpu_sets.fiber_cpu_sets.end());
+            for (const auto& cpu_id : search->second.vec())
+            {
+                auto& value = busy_poll_timeouts[cpu_id];
+                value       = std::max(value, timeout);
+            }
+        }
+    }
 
     system.topology().cpu_set().for_each_bit([&](std::int32_t idx, std::int32_t cpu_id) {
         DVLOG(10) << "initializing fiber queue " << idx << " of " << cpu_count << " on cpu_id " << cpu_id;
-        m_queues[cpu_id] = std::make_shared<FiberTaskQueue>(system, cpu_id);
+        FiberTaskQueueConfig config;
+        config.deadline_scheduling = system.options().fiber_pool().enable_deadline_scheduling();
+        config.enable_telemetry    = system.options().fiber_pool().enable_scheduler_telemetry();
+        config.stack_size          = system.options().fiber_pool().stack_size();
+        config.stack_guard_pages   = system.options().fiber_pool().enable_stack_guard_pages();
+        config.stack_pool_capacity = system.options().fiber_pool().stack_pool_capacity();
+        config.stack_membind       = system.options().fiber_pool().enable_memory_binding();
+        if (m_steal_group)
+        {
+            config.steal_group = m_steal_group;
+            config.steal_slot  = idx;
+        }
+        auto busy_poll = busy_poll_timeouts.find(cpu_id);
+        if (busy_poll != busy_poll_timeouts.end())
+        {
+            DVLOG(10) << "fiber queue on cpu_id " << cpu_id << " will busy poll when idle";
+            config.busy_poll_timeout = busy_poll->second;
+        }
+        m_queues[cpu_id] = std::make_shared<FiberTaskQueue>(system, cpu_id, std::move(config));
     });
 }
 
@@ -81,6 +274,22 @@ void FiberManager::join()
     }
 }
 
+void FiberManager::register_metrics(metrics::Registry& registry) const
+{
+    for (const auto& [cpu_id, queue] : m_queues)
+    {
+        auto stats = queue->stats();
+        if (!stats)
+        {
+            continue;
+        }
+
+        // the collector holds only the statistics, not the queue, so it does not extend the lifetime of the thread
+        auto exporter = std::make_shared<FiberSchedulerMetrics>(registry, cpu_id, std::move(stats));
+        registry.add_collector([exporter] { exporter->update(); });
+    }
+}
+
 std::shared_ptr<FiberTaskQueue> FiberManager::task_queue(std::uint32_t cpu_id)
 {
     auto search = m_queues.find(cpu_id);
@@ -23,6 +23,7 @@
 
 #include "internal/system/fiber_pool.hpp"
 #include "internal/system/fiber_task_queue.hpp"
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
 
 #include <glog/logging.h>
 
@@ -34,6 +35,10 @@
 #include <utility>
 #include <vector>
 
+namespace srf::metrics {
+class Registry;
+}  // namespace srf::metrics
+
 namespace srf::internal::system {
 
 class FiberManager final
@@ -48,6 +53,11 @@ class FiberManager final
     [[nodiscard]] std::shared_ptr<FiberTaskQueue> task_queue(std::uint32_t cpu_id);
     [[nodiscard]] std::shared_ptr<FiberPool> make_pool(CpuSet cpu_set);
 
+    /**
+     * @brief export the scheduler statistics of every fiber task queue to registry
+     */
+    void register_metrics(metrics::Registry& registry) const;
+
     template <class F>
     [[nodiscard]] auto enqueue_fiber(std::uint32_t queue_idx, const F& to_enqueue) const
         -> Future<typename std::result_of<F(std::uint32_t)>::type>
@@ -104,6 +114,7 @@ class FiberManager final
     void join();
 
     const CpuSet m_cpu_set;
+    std::shared_ptr<FiberWorkStealingGroup> m_steal_group;
     std::map<std::uint32_t, std::shared_ptr<FiberTaskQueue>> m_queues;
 };
 
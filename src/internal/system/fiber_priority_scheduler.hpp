@@ -17,21 +17,72 @@
 
 #pragma once
 
+#include "internal/system/fiber_idle_waiter.hpp"
+#include "internal/system/fiber_ready_queue.hpp"
+#include "internal/system/fiber_scheduler_stats.hpp"
+
 #include <boost/fiber/all.hpp>
 #include <boost/fiber/scheduler.hpp>
+#include <boost/intrusive/set_hook.hpp>
+
+#include <chrono>
+#include <cstdint>
 
 namespace srf::internal::system {
 
+class FiberDeadlineReadyQueue;
+
 class FiberPriorityProps : public boost::fibers::fiber_properties
 {
   public:
     FiberPriorityProps(boost::fibers::context* ctx) : fiber_properties(ctx), m_priority(0) {}
 
+    boost::fibers::context* get_context() const
+    {
+        return ctx_;
+    }
+
     int get_priority() const
     {
         return m_priority;
     }
 
+    /**
+     * @brief relative deadline of the fiber; zero means the fiber has no deadline
+     *
+     * Only honored by the FiberDeadlineScheduler: each time the fiber becomes ready its absolute deadline is set to
+     * now + relative deadline.
+     */
+    std::chrono::nanoseconds get_relative_deadline() const
+    {
+        return m_relative_deadline;
+    }
+
+    void set_relative_deadline(std::chrono::nanoseconds deadline)
+    {
+        if (deadline != m_relative_deadline)
+        {
+            m_relative_deadline = deadline;
+            notify();
+        }
+    }
+
+    bool is_pinned() const
+    {
+        return m_pinned;
+    }
+
+    /**
+     * @brief keep the fiber on its current thread under a FiberWorkStealingScheduler
+     *
+     * Only the running fiber should change its own pinning; the change applies the next time the fiber becomes ready.
+     * Used while a fiber holds state owned by its thread, e.g. a descriptor watched by the thread's FiberIdleWaiter.
+     */
+    void set_pinned(bool pinned)
+    {
+        m_pinned = pinned;
+    }
+
     // Call this method to alter priority, because we must notify
     // priority_scheduler of any change.
     void set_priority(int p)
@@ -47,50 +98,59 @@ class FiberPriorityProps : public boost::fibers::fiber_properties
 
   private:
     int m_priority;
+    bool m_pinned{false};
+    std::chrono::nanoseconds m_relative_deadline{std::chrono::nanoseconds::zero()};
+
+    // owned by FiberDeadlineReadyQueue while the fiber is ready
+    friend FiberDeadlineReadyQueue;
+    boost::intrusive::set_member_hook<> m_deadline_hook;
+    std::chrono::steady_clock::time_point m_deadline;
+    std::uint64_t m_sequence{0};
 };
 
 class FiberPriorityScheduler : public boost::fibers::algo::algorithm_with_properties<FiberPriorityProps>
 {
   private:
-    using rqueue_t = boost::fibers::scheduler::ready_queue_type;
-
-    rqueue_t m_rqueue;
-    std::mutex m_mtx{};
-    std::condition_variable m_cnd{};
-    bool m_flag{false};
+    FiberReadyQueue m_rqueue;
+    FiberIdleWaiter m_waiter;
+    FiberSchedulerStats* m_stats;
+    FiberRunClock m_clock;
 
   public:
-    FiberPriorityScheduler() : m_rqueue() {}  // NOLINT
+    FiberPriorityScheduler(std::chrono::nanoseconds busy_poll_timeout = std::chrono::nanoseconds::zero(),
+                           FiberSchedulerStats* stats                 = nullptr) :
+      m_waiter(busy_poll_timeout),
+      m_stats(stats)
+    {}
 
     // For a subclass of algorithm_with_properties<>, it's important to
     // override the correct awakened() overload.
     void awakened(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept final
     {
-        int ctx_priority = props.get_priority();
         // With this scheduler, fibers with higher priority values are
         // preferred over fibers with lower priority values. But fibers with
         // equal priority values are processed in round-robin fashion. So when
         // we're handed a new context*, put it at the end of the fibers
-        // with that same priority. In other words: search for the first fiber
-        // in the queue with LOWER priority, and insert before that one.
-        rqueue_t::iterator i(
-            std::find_if(m_rqueue.begin(), m_rqueue.end(), [this, ctx_priority](boost::fibers::context& c) {
-                return properties(&c).get_priority() < ctx_priority;
-            }));
-        // Now, whether or not we found a fiber with lower priority,
-        // insert this new fiber here.
-        m_rqueue.insert(i, *ctx);
+        // with that same priority.
+        m_rqueue.push(ctx, props.get_priority());
     }
 
     boost::fibers::context* pick_next() noexcept final
     {
-        // if ready queue is empty, just tell caller
-        if (m_rqueue.empty())
+        // if ready queue is empty, nullptr tells the caller
+        auto* ctx = m_rqueue.pop();
+        if (m_stats != nullptr)
         {
-            return nullptr;
+            if (ctx != nullptr)
+            {
+                m_stats->record_switch(m_rqueue.size());
+                m_clock.resumed(*m_stats, FiberReadyQueue::bucket_index(properties(ctx).get_priority()));
+            }
+            else
+            {
+                m_clock.idle(*m_stats);
+            }
         }
-        boost::fibers::context* ctx(&m_rqueue.front());
-        m_rqueue.pop_front();
         return ctx;
     }
 
@@ -115,7 +175,7 @@ class FiberPriorityScheduler : public boost::fibers::algo::algorithm_with_proper
         }
 
         // Found ctx: unlink it
-        ctx->ready_unlink();
+        m_rqueue.remove(ctx);
 
         // Here we know that ctx was in our ready queue, but we've unlinked
         // it. We happen to have a method that will (re-)add a context* to the
@@ -125,26 +185,19 @@ class FiberPriorityScheduler : public boost::fibers::algo::algorithm_with_proper
 
     void suspend_until(std::chrono::steady_clock::time_point const& time_point) noexcept final
     {
-        if ((std::chrono::steady_clock::time_point::max)() == time_point)
+        if (m_stats == nullptr)
         {
-            std::unique_lock<std::mutex> lk(m_mtx);
-            m_cnd.wait(lk, [this]() { return m_flag; });
-            m_flag = false;
-        }
-        else
-        {
-            std::unique_lock<std::mutex> lk(m_mtx);
-            m_cnd.wait_until(lk, time_point, [this]() { return m_flag; });
-            m_flag = false;
+            m_waiter.wait_until(time_point);
+            return;
         }
+        auto start = std::chrono::steady_clock::now();
+        m_waiter.wait_until(time_point);
+        m_stats->record_idle(std::chrono::steady_clock::now() - start);
     }
 
     void notify() noexcept final
     {
-        std::unique_lock<std::mutex> lk(m_mtx);
-        m_flag = true;
-        lk.unlock();
-        m_cnd.notify_all();
+        m_waiter.notify();
     }
 };
 
@@ -0,0 +1,160 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/constants.hpp>
+
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/scheduler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace srf::internal::system {
+
+/**
+ * @brief Ready queue with constant time insertion and removal ordered by fiber priority
+ *
+ * Ready contexts are held in one intrusive list per priority; a bitmap tracks which buckets may be non-empty, so the
+ * highest priority ready context is found with a single count-leading-zeros. Within a priority contexts are processed
+ * in round-robin order. Priorities outside [SRF_MIN_FIBER_PRIORITY, SRF_MAX_FIBER_PRIORITY] are clamped to the range.
+ *
+ * Contexts unlinked directly via context::ready_unlink must be accounted for with unlinked(); the bit of a bucket
+ * emptied that way is cleared lazily by the next scan.
+ */
+class FiberReadyQueue final
+{
+    using bucket_t = boost::fibers::scheduler::ready_queue_type;
+
+    static constexpr int BucketCount = SRF_MAX_FIBER_PRIORITY - SRF_MIN_FIBER_PRIORITY + 1;
+    static_assert(BucketCount > 0 && BucketCount <= 64, "fiber priority range must fit in a 64-bit bitmap");
+
+  public:
+    FiberReadyQueue() = default;
+
+    static std::size_t bucket_index(int priority)
+    {
+        return static_cast<std::size_t>(std::clamp(priority, SRF_MIN_FIBER_PRIORITY, SRF_MAX_FIBER_PRIORITY) -
+                                        SRF_MIN_FIBER_PRIORITY);
+    }
+
+    /**
+     * @brief append ctx after all ready contexts of equal priority
+     */
+    void push(boost::fibers::context* ctx, int priority)
+    {
+        auto idx = bucket_index(priority);
+        m_buckets[idx].push_back(*ctx);
+        m_bitmap |= (std::uint64_t{1} << idx);
+        ++m_size;
+    }
+
+    /**
+     * @brief remove and return the oldest context of the highest priority, or nullptr if empty
+     */
+    boost::fibers::context* pop()
+    {
+        while (m_size != 0)
+        {
+            auto idx     = highest();
+            auto& bucket = m_buckets[idx];
+            if (bucket.empty())
+            {
+                m_bitmap &= ~(std::uint64_t{1} << idx);
+                continue;
+            }
+            auto* ctx = &bucket.front();
+            bucket.pop_front();
+            --m_size;
+            if (bucket.empty())
+            {
+                m_bitmap &= ~(std::uint64_t{1} << idx);
+            }
+            return ctx;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief first context in priority order satisfying predicate, or nullptr; the context is not removed
+     */
+    template <typename PredicateT>
+    boost::fibers::context* find_first(PredicateT&& predicate)
+    {
+        auto bitmap = m_bitmap;
+        while (bitmap != 0)
+        {
+            auto idx = highest(bitmap);
+            for (auto& ctx : m_buckets[idx])
+            {
+                if (predicate(ctx))
+                {
+                    return &ctx;
+                }
+            }
+            bitmap &= ~(std::uint64_t{1} << idx);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief remove a context that is linked in this queue
+     */
+    void remove(boost::fibers::context* ctx)
+    {
+        ctx->ready_unlink();
+        unlinked();
+    }
+
+    /**
+     * @brief account for a context of this queue that was removed via context::ready_unlink
+     */
+    void unlinked()
+    {
+        --m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+  private:
+    std::size_t highest() const
+    {
+        return highest(m_bitmap);
+    }
+
+    static std::size_t highest(std::uint64_t bitmap)
+    {
+        return 63 - __builtin_clzll(bitmap);
+    }
+
+    std::array<bucket_t, BucketCount> m_buckets;
+    std::uint64_t m_bitmap{0};
+    std::size_t m_size{0};
+};
+
+}  // namespace srf::internal::system
@@ -0,0 +1,137 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/constants.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace srf::internal::system {
+
+/**
+ * @brief Scheduling statistics of a single fiber scheduler thread
+ *
+ * Only the scheduler thread writes; any thread may read. All updates are relaxed atomic adds to counters that are not
+ * shared with other writers, so recording costs about as much as a non-atomic increment. Durations are in
+ * nanoseconds. Histograms use power-of-two buckets: bucket i counts observations in [2^(i-1), 2^i), bucket 0 counts
+ * zeros and the last bucket is unbounded; idle periods are bucketed in microseconds.
+ */
+struct FiberSchedulerStats
+{
+    static constexpr std::size_t HistogramBuckets = 32;
+    static constexpr std::size_t PriorityClasses  = SRF_MAX_FIBER_PRIORITY - SRF_MIN_FIBER_PRIORITY + 1;
+
+    using counter_t   = std::atomic<std::uint64_t>;
+    using histogram_t = std::array<counter_t, HistogramBuckets>;
+
+    // number of fibers resumed by the scheduler
+    counter_t context_switches{0};
+
+    // number of times the thread ran out of ready fibers and time spent suspended
+    counter_t idle_periods{0};
+    counter_t idle_ns{0};
+    histogram_t idle_us_histogram{};
+
+    // number of ready fibers queued behind the fiber being resumed, sampled at every context switch
+    counter_t ready_queue_length{0};
+    counter_t ready_queue_length_sum{0};
+    histogram_t ready_queue_length_histogram{};
+
+    // time between resuming a fiber and the next scheduling decision, by priority class of the resumed fiber
+    std::array<counter_t, PriorityClasses> run_ns_by_priority{};
+
+    static std::size_t histogram_bucket(std::uint64_t value)
+    {
+        if (value == 0)
+        {
+            return 0;
+        }
+        auto bucket = static_cast<std::size_t>(64 - __builtin_clzll(value));
+        return bucket < HistogramBuckets ? bucket : HistogramBuckets - 1;
+    }
+
+    static void add(counter_t& counter, std::uint64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    void record_idle(std::chrono::nanoseconds duration)
+    {
+        auto ns = static_cast<std::uint64_t>(duration.count());
+        add(idle_periods, 1);
+        add(idle_ns, ns);
+        add(idle_us_histogram[histogram_bucket(ns / 1000)], 1);
+    }
+
+    void record_switch(std::size_t ready)
+    {
+        add(context_switches, 1);
+        ready_queue_length.store(ready, std::memory_order_relaxed);
+        add(ready_queue_length_sum, ready);
+        add(ready_queue_length_histogram[histogram_bucket(ready)], 1);
+    }
+
+    void record_run(std::size_t priority_class, std::chrono::nanoseconds duration)
+    {
+        add(run_ns_by_priority[priority_class], static_cast<std::uint64_t>(duration.count()));
+    }
+};
+
+/**
+ * @brief Records the time a scheduler spends running each priority class
+ *
+ * Each scheduling decision closes the slice of the previously resumed fiber and, if a fiber was picked, opens a new
+ * one. Contexts pinned to the thread (main and dispatcher fibers) are attributed like any other fiber.
+ */
+class FiberRunClock
+{
+  public:
+    void resumed(FiberSchedulerStats& stats, std::size_t priority_class)
+    {
+        auto now = std::chrono::steady_clock::now();
+        close(stats, now);
+        m_priority_class = priority_class;
+        m_start          = now;
+        m_running        = true;
+    }
+
+    void idle(FiberSchedulerStats& stats)
+    {
+        close(stats, std::chrono::steady_clock::now());
+        m_running = false;
+    }
+
+  private:
+    void close(FiberSchedulerStats& stats, std::chrono::steady_clock::time_point now)
+    {
+        if (m_running)
+        {
+            stats.record_run(m_priority_class, now - m_start);
+        }
+    }
+
+    std::chrono::steady_clock::time_point m_start;
+    std::size_t m_priority_class{0};
+    bool m_running{false};
+};
+
+}  // namespace srf::internal::system
@@ -0,0 +1,155 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/system/fiber_stack_pool.hpp"
+
+#include <glog/logging.h>
+#include <boost/context/stack_traits.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace srf::internal::system {
+
+namespace {
+
+std::size_t round_up(std::size_t size, std::size_t alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+}  // namespace
+
+FiberStackPool::FiberStackPool(std::size_t stack_size,
+                               bool guard_pages,
+                               std::size_t capacity,
+                               hwloc_topology_t topology,
+                               CpuSet membind_cpu_set) :
+  m_page_size(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))),
+  m_stack_size(round_up(std::max(stack_size == 0 ? boost::context::stack_traits::default_size() : stack_size,
+                                 boost::context::stack_traits::minimum_size()),
+                        m_page_size)),
+  m_guard_size(guard_pages ? m_page_size : 0),
+  m_capacity(capacity),
+  m_topology(topology),
+  m_membind_cpu_set(std::move(membind_cpu_set)),
+  m_membind(m_topology != nullptr && !m_membind_cpu_set.empty())
+{
+    m_stacks.reserve(m_capacity);
+}
+
+FiberStackPool::~FiberStackPool()
+{
+    for (auto* base : m_stacks)
+    {
+        ::munmap(base, m_stack_size + m_guard_size);
+    }
+}
+
+void* FiberStackPool::map_stack()
+{
+    const auto size = m_stack_size + m_guard_size;
+    void* base      = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+    if (m_guard_size != 0)
+    {
+        // stacks grow down; the lowest page traps overflows
+        CHECK_EQ(::mprotect(base, m_guard_size, PROT_NONE), 0);
+    }
+
+    if (m_membind)
+    {
+        // bind before first touch so the pages are faulted in on the numa node of the owning queue
+        auto rc = hwloc_set_area_membind(m_topology, base, size, &m_membind_cpu_set.bitmap(), HWLOC_MEMBIND_BIND, 0);
+        if (rc == -1 && m_membind.exchange(false))
+        {
+            DVLOG(10) << "unable to bind fiber stacks to the numa node of cpu_set " << m_membind_cpu_set
+                      << "; continuing without an explicit memory binding";
+        }
+    }
+
+    ++m_mapped_count;
+    return base;
+}
+
+boost::context::stack_context FiberStackPool::allocate()
+{
+    void* base = nullptr;
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        if (!m_stacks.empty())
+        {
+            base = m_stacks.back();
+            m_stacks.pop_back();
+        }
+    }
+
+    if (base != nullptr)
+    {
+        ++m_reused_count;
+    }
+    else
+    {
+        base = map_stack();
+    }
+
+    boost::context::stack_context sctx;
+    sctx.size = m_stack_size + m_guard_size;
+    sctx.sp   = static_cast<char*>(base) + sctx.size;
+    return sctx;
+}
+
+void FiberStackPool::deallocate(boost::context::stack_context& sctx)
+{
+    DCHECK_EQ(sctx.size, m_stack_size + m_guard_size);
+    void* base = static_cast<char*>(sctx.sp) - sctx.size;
+
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        if (m_stacks.size() < m_capacity)
+        {
+            m_stacks.push_back(base);
+            return;
+        }
+    }
+
+    ::munmap(base, sctx.size);
+}
+
+std::size_t FiberStackPool::stack_size() const
+{
+    return m_stack_size;
+}
+
+std::size_t FiberStackPool::mapped_count() const
+{
+    return m_mapped_count;
+}
+
+std::size_t FiberStackPool::reused_count() const
+{
+    return m_reused_count;
+}
+
+}  // namespace srf::internal::system
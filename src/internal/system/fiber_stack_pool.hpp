@@ -0,0 +1,116 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/core/bitmap.hpp>
+#include <srf/utils/macros.hpp>
+
+#include <boost/context/stack_context.hpp>
+#include <hwloc.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace srf::internal::system {
+
+/**
+ * @brief Cache of fixed-size fiber stacks owned by a single FiberTaskQueue
+ *
+ * Stacks are mmapped on first use, optionally with a PROT_NONE guard page below the stack, and when a cpu set is
+ * provided, bound to the NUMA node(s) of that cpu set before they are first touched. Stacks of terminated fibers are
+ * returned to the pool and reused by subsequent fibers; up to capacity stacks are retained, the rest are unmapped.
+ *
+ * Fibers may terminate on a thread other than the one which launched them, so allocate and deallocate are thread safe.
+ */
+class FiberStackPool final
+{
+  public:
+    FiberStackPool(std::size_t stack_size,
+                   bool guard_pages,
+                   std::size_t capacity,
+                   hwloc_topology_t topology = nullptr,
+                   CpuSet membind_cpu_set    = CpuSet());
+    ~FiberStackPool();
+
+    DELETE_COPYABILITY(FiberStackPool);
+    DELETE_MOVEABILITY(FiberStackPool);
+
+    boost::context::stack_context allocate();
+    void deallocate(boost::context::stack_context& sctx);
+
+    /**
+     * @brief usable stack size in bytes, excluding the guard page
+     */
+    std::size_t stack_size() const;
+
+    /**
+     * @brief number of stacks mapped since construction
+     */
+    std::size_t mapped_count() const;
+
+    /**
+     * @brief number of allocations served from the pool
+     */
+    std::size_t reused_count() const;
+
+  private:
+    void* map_stack();
+
+    const std::size_t m_page_size;
+    const std::size_t m_stack_size;
+    const std::size_t m_guard_size;
+    const std::size_t m_capacity;
+    hwloc_topology_t m_topology;
+    const CpuSet m_membind_cpu_set;
+    std::atomic<bool> m_membind{false};
+
+    std::mutex m_mutex;
+    std::vector<void*> m_stacks;
+
+    std::atomic<std::size_t> m_mapped_count{0};
+    std::atomic<std::size_t> m_reused_count{0};
+};
+
+/**
+ * @brief boost::fibers StackAllocator backed by a FiberStackPool
+ *
+ * Each fiber holds a copy of its allocator, which keeps the pool alive until the fiber's stack is released.
+ */
+class PooledStackAllocator
+{
+  public:
+    PooledStackAllocator(std::shared_ptr<FiberStackPool> pool) : m_pool(std::move(pool)) {}
+
+    boost::context::stack_context allocate()
+    {
+        return m_pool->allocate();
+    }
+
+    void deallocate(boost::context::stack_context& sctx) noexcept
+    {
+        m_pool->deallocate(sctx);
+    }
+
+  private:
+    std::shared_ptr<FiberStackPool> m_pool;
+};
+
+}  // namespace srf::internal::system
@@ -17,19 +17,25 @@
 
 #include "internal/system/fiber_task_queue.hpp"
 
+#include "internal/system/fiber_deadline_scheduler.hpp"
 #include "internal/system/fiber_priority_scheduler.hpp"
+#include "internal/system/fiber_scheduler_stats.hpp"
+#include "internal/system/fiber_stack_pool.hpp"
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
 #include "internal/system/system.hpp"
 #include "srf/core/fiber_meta_data.hpp"
 #include "srf/core/task_queue.hpp"
 #include "srf/types.hpp"
 
 #include <glog/logging.h>
-#include <boost/fiber/channel_op_status.hpp>
 #include <boost/fiber/context.hpp>
 #include <boost/fiber/fiber.hpp>
 #include <boost/fiber/future/future.hpp>
 #include <boost/fiber/operations.hpp>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <type_traits>
@@ -37,9 +43,19 @@
 
 namespace srf::internal::system {
 
-FiberTaskQueue::FiberTaskQueue(const System& system, CpuSet cpu_affinity, std::size_t channel_size) :
-  m_queue(channel_size),
+FiberTaskQueue::FiberTaskQueue(const System& system, CpuSet cpu_affinity) :
+  FiberTaskQueue(system, std::move(cpu_affinity), FiberTaskQueueConfig{})
+{}
+
+FiberTaskQueue::FiberTaskQueue(const System& system, CpuSet cpu_affinity, FiberTaskQueueConfig config) :
   m_cpu_affinity(std::move(cpu_affinity)),
+  m_config(std::move(config)),
+  m_stats(m_config.enable_telemetry ? std::make_shared<FiberSchedulerStats>() : nullptr),
+  m_stack_pool(std::make_shared<FiberStackPool>(m_config.stack_size,
+                                                m_config.stack_guard_pages,
+                                                m_config.stack_pool_capacity,
+                                                m_config.stack_membind ? system.topology().handle() : nullptr,
+                                                m_config.stack_membind ? m_cpu_affinity : CpuSet())),
   m_thread(system.make_thread("fiberq", m_cpu_affinity, [this] { main(); }))
 {
     DVLOG(10) << "awaiting fiber task queue worker thread running on cpus " << m_cpu_affinity;
@@ -58,25 +74,89 @@ const CpuSet& FiberTaskQueue::affinity() const
     return m_cpu_affinity;
 }
 
-boost::fibers::buffered_channel<core::FiberTaskQueue::task_pkg_t>& FiberTaskQueue::task_queue()
+std::shared_ptr<const FiberSchedulerStats> FiberTaskQueue::stats() const
 {
-    return m_queue;
+    return m_stats;
+}
+
+const FiberStackPool& FiberTaskQueue::stack_pool() const
+{
+    CHECK(m_stack_pool);
+    return *m_stack_pool;
+}
+
+bool FiberTaskQueue::push_tasks(core::FiberTask* first, core::FiberTask* last)
+{
+    if (m_closed.load())
+    {
+        return false;
+    }
+
+    m_tasks.push(first, last);
+
+    // only wake the main fiber if it is parked; pairs with the fence in wait_for_tasks so that either the consumer
+    // observes the push or the producer observes m_sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleeping.load())
+    {
+        std::lock_guard<boost::fibers::mutex> lock(m_sleep_mutex);
+        m_sleeping = false;
+        m_sleep_cv.notify_one();
+    }
+    return true;
+}
+
+void FiberTaskQueue::wait_for_tasks()
+{
+    std::unique_lock<boost::fibers::mutex> lock(m_sleep_mutex);
+    m_sleeping = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // a producer which pushed before observing m_sleeping will not notify; recheck before parking. pop() may miss a
+    // push which is still being linked, but that producer reads m_sleeping after linking and will notify
+    if (auto* task = m_tasks.pop())
+    {
+        m_sleeping = false;
+        lock.unlock();
+        launch(std::unique_ptr<core::FiberTask>(task));
+        return;
+    }
+    if (m_closed.load())
+    {
+        m_sleeping = false;
+        return;
+    }
+
+    m_sleep_cv.wait(lock, [this] { return !m_sleeping.load(); });
 }
 
 void FiberTaskQueue::main()
 {
-    // enable priority scheduler
-    boost::fibers::use_scheduling_algorithm<FiberPriorityScheduler>();
+    if (m_config.steal_group)
+    {
+        // enable priority scheduler with work stealing between the members of the group
+        CHECK_LT(m_config.steal_slot, m_config.steal_group->size());
+        boost::fibers::use_scheduling_algorithm<FiberWorkStealingScheduler>(
+            *m_config.steal_group, m_config.steal_slot, m_config.busy_poll_timeout, m_stats.get());
+    }
+    else if (m_config.deadline_scheduling)
+    {
+        // enable earliest-deadline-first scheduler
+        boost::fibers::use_scheduling_algorithm<FiberDeadlineScheduler>(m_config.busy_poll_timeout, m_stats.get());
+    }
+    else
+    {
+        // enable priority scheduler
+        boost::fibers::use_scheduling_algorithm<FiberPriorityScheduler>(m_config.busy_poll_timeout, m_stats.get());
+    }
 
-    task_pkg_t task_pkg;
-    while (true)
+    while (!m_closed.load())
     {
-        auto rc = m_queue.pop(task_pkg);
-        if (rc == boost::fibers::channel_op_status::closed)
+        while (auto* task = m_tasks.pop())
         {
-            break;
+            launch(std::unique_ptr<core::FiberTask>(task));
         }
-        launch(std::move(task_pkg));
+        wait_for_tasks();
     }
 
     if (detached() != 0U)
@@ -84,8 +164,13 @@ void FiberTaskQueue::main()
         VLOG(10) << *this << ": waiting on detached fibers";
     }
 
+    // submissions are counted before they are pushed, so tasks which raced with shutdown are still drained here
     while (detached() != 0U)
     {
+        while (auto* task = m_tasks.pop())
+        {
+            launch(std::unique_ptr<core::FiberTask>(task));
+        }
         boost::this_fiber::yield();
     }
 
@@ -94,16 +179,28 @@ void FiberTaskQueue::main()
 
 void FiberTaskQueue::shutdown()
 {
-    m_queue.close();
+    m_closed = true;
+
+    // wake the main fiber if it is parked
+    std::lock_guard<boost::fibers::mutex> lock(m_sleep_mutex);
+    m_sleeping = false;
+    m_sleep_cv.notify_one();
 }
 
-void FiberTaskQueue::launch(task_pkg_t&& pkg) const
+void FiberTaskQueue::launch(std::unique_ptr<core::FiberTask> task)
 {
+    auto priority = task->meta_data().priority;
+    auto deadline = task->meta_data().deadline;
+
     // default is a post, not a dispatch, so the task is only enqueued with the fiber scheduler
-    boost::fibers::fiber fiber(std::move(pkg.first));
+    boost::fibers::fiber fiber(std::allocator_arg, PooledStackAllocator(m_stack_pool), [this, t = std::move(task)] {
+        t->run();
+        task_completed();
+    });
     auto& props(fiber.properties<FiberPriorityProps>());
-    props.set_priority(pkg.second.priority);
-    DVLOG(10) << *this << ": created fiber " << fiber.get_id() << " with priority " << pkg.second.priority;
+    props.set_priority(priority);
+    props.set_relative_deadline(deadline);
+    DVLOG(10) << *this << ": created fiber " << fiber.get_id() << " with priority " << priority;
     fiber.detach();
 }
 
@@ -21,36 +21,91 @@
 
 #include "srf/core/bitmap.hpp"
 
-#include <boost/fiber/buffered_channel.hpp>
+#include <boost/fiber/condition_variable.hpp>
+#include <boost/fiber/mutex.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <thread>
 
 namespace srf::internal::system {
 
 class System;
+class FiberWorkStealingGroup;
+struct FiberSchedulerStats;
+class FiberStackPool;
+
+/**
+ * @brief Scheduling configuration of the worker thread of a FiberTaskQueue
+ */
+struct FiberTaskQueueConfig
+{
+    // if set, ready fibers can be stolen by, and this queue can steal from, the other members of the group;
+    // steal_slot is the index of this queue in the group
+    std::shared_ptr<FiberWorkStealingGroup> steal_group{nullptr};
+    std::size_t steal_slot{0};
+
+    // if non-zero, an idle worker thread busy polls for this long before blocking
+    std::chrono::nanoseconds busy_poll_timeout{std::chrono::nanoseconds::zero()};
+
+    // if true, ready fibers are ordered by earliest deadline rather than by priority; exclusive with steal_group
+    bool deadline_scheduling{false};
+
+    // if true, the scheduler records FiberSchedulerStats
+    bool enable_telemetry{true};
+
+    // fiber stacks; a stack_size of 0 selects the boost::context default. if enabled, stacks are bound to the numa
+    // node of the queue's cpu affinity
+    std::size_t stack_size{0};
+    bool stack_guard_pages{true};
+    std::size_t stack_pool_capacity{256};
+    bool stack_membind{false};
+};
 
 class FiberTaskQueue final : public core::FiberTaskQueue
 {
   public:
-    FiberTaskQueue(const System& system, CpuSet cpu_affinity, std::size_t channel_size = 64);
+    FiberTaskQueue(const System& system, CpuSet cpu_affinity);
+    FiberTaskQueue(const System& system, CpuSet cpu_affinity, FiberTaskQueueConfig config);
     ~FiberTaskQueue() final;
 
     const CpuSet& affinity() const final;
 
     void shutdown();
 
+    /**
+     * @brief scheduling statistics of the worker thread; nullptr if telemetry is disabled
+     */
+    std::shared_ptr<const FiberSchedulerStats> stats() const;
+
+    /**
+     * @brief pool from which the stacks of fibers launched by this queue are allocated
+     */
+    const FiberStackPool& stack_pool() const;
+
     friend std::ostream& operator<<(std::ostream& os, const FiberTaskQueue& ftq);
 
   private:
     void main();
-    void launch(task_pkg_t&& pkg) const;
+    void launch(std::unique_ptr<core::FiberTask> task);
+    void wait_for_tasks();
+
+    bool push_tasks(core::FiberTask* first, core::FiberTask* last) final;
 
-    boost::fibers::buffered_channel<task_pkg_t>& task_queue() final;
+    // submissions are lock-free; the mutex and condition variable are only used to park and wake an idle main fiber
+    core::FiberTaskList m_tasks;
+    std::atomic<bool> m_closed{false};
+    std::atomic<bool> m_sleeping{false};
+    boost::fibers::mutex m_sleep_mutex;
+    boost::fibers::condition_variable m_sleep_cv;
 
-    boost::fibers::buffered_channel<task_pkg_t> m_queue;
     CpuSet m_cpu_affinity;
+    FiberTaskQueueConfig m_config;
+    std::shared_ptr<FiberSchedulerStats> m_stats;
+    std::shared_ptr<FiberStackPool> m_stack_pool;
     std::thread m_thread;
 };
 
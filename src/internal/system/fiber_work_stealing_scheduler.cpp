@@ -0,0 +1,329 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace srf::internal::system {
+
+namespace {
+
+// the main and dispatcher fibers of a thread are pinned by boost; worker fibers may pin themselves while they hold
+// thread-local state, see FiberPriorityProps::set_pinned
+bool is_stealable(const boost::fibers::context& ctx)
+{
+    if (ctx.is_context(boost::fibers::type::pinned_context))
+    {
+        return false;
+    }
+    const auto* props = static_cast<const FiberPriorityProps*>(ctx.get_properties());
+    return props == nullptr || !props->is_pinned();
+}
+
+}  // namespace
+
+FiberWorkStealingGroup::FiberWorkStealingGroup(std::vector<std::uint32_t> numa_ids) : m_members(numa_ids.size())
+{
+    const auto count = numa_ids.size();
+    for (std::size_t slot = 0; slot < count; ++slot)
+    {
+        // visit peers starting from the next slot so thieves on the same node do not all hammer the same victim
+        for (std::size_t offset = 1; offset < count; ++offset)
+        {
+            auto peer = (slot + offset) % count;
+            if (numa_ids[peer] == numa_ids[slot])
+            {
+                m_members[slot].local_peers.push_back(peer);
+            }
+            else
+            {
+                m_members[slot].remote_peers.push_back(peer);
+            }
+        }
+    }
+}
+
+FiberWorkStealingGroup::~FiberWorkStealingGroup() = default;
+
+std::size_t FiberWorkStealingGroup::size() const
+{
+    return m_members.size();
+}
+
+void FiberWorkStealingGroup::register_scheduler(std::size_t slot, FiberWorkStealingScheduler* scheduler)
+{
+    CHECK_LT(slot, m_members.size());
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& member = m_members[slot];
+    CHECK(member.owner == nullptr) << "work stealing slot " << slot << " already registered";
+
+    // the group holds a reference so a scheduler remains valid to its peers after its thread has exited
+    member.owner = scheduler;
+    member.scheduler.store(scheduler);
+}
+
+boost::fibers::context* FiberWorkStealingGroup::steal(std::size_t slot)
+{
+    auto steal_from = [this](const std::vector<std::size_t>& peers) -> boost::fibers::context* {
+        while (true)
+        {
+            FiberWorkStealingScheduler* victim = nullptr;
+            int best_priority                  = 0;
+
+            for (const auto& peer : peers)
+            {
+                auto* scheduler = m_members[peer].scheduler.load();
+                int priority;
+                if (scheduler != nullptr && scheduler->peek_stealable(priority) &&
+                    (victim == nullptr || priority > best_priority))
+                {
+                    victim        = scheduler;
+                    best_priority = priority;
+                }
+            }
+
+            if (victim == nullptr)
+            {
+                return nullptr;
+            }
+
+            // the victim may have run or lost the fiber since it was observed; rescan if so
+            auto* ctx = victim->steal();
+            if (ctx != nullptr)
+            {
+                return ctx;
+            }
+        }
+    };
+
+    const auto& member = m_members[slot];
+    auto* ctx          = steal_from(member.local_peers);
+    if (ctx == nullptr)
+    {
+        ctx = steal_from(member.remote_peers);
+    }
+    return ctx;
+}
+
+void FiberWorkStealingGroup::wake_idle_peer(std::size_t slot)
+{
+    if (m_idle_count.load() == 0)
+    {
+        return;
+    }
+
+    const auto& member = m_members[slot];
+    for (const auto* peers : {&member.local_peers, &member.remote_peers})
+    {
+        for (const auto& peer : *peers)
+        {
+            auto* scheduler = m_members[peer].scheduler.load();
+            if (scheduler != nullptr && scheduler->m_idle.load())
+            {
+                scheduler->notify();
+                return;
+            }
+        }
+    }
+}
+
+bool FiberWorkStealingGroup::has_stealable_work(std::size_t slot) const
+{
+    const auto& member = m_members[slot];
+    for (const auto* peers : {&member.local_peers, &member.remote_peers})
+    {
+        for (const auto& peer : *peers)
+        {
+            auto* scheduler = m_members[peer].scheduler.load();
+            if (scheduler != nullptr && scheduler->m_stealable.load() != 0)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+FiberWorkStealingScheduler::FiberWorkStealingScheduler(FiberWorkStealingGroup& group,
+                                                       std::size_t slot,
+                                                       std::chrono::nanoseconds busy_poll_timeout,
+                                                       FiberSchedulerStats* stats) :
+  m_group(group),
+  m_slot(slot),
+  m_waiter(busy_poll_timeout),
+  m_stats(stats)
+{
+    m_group.register_scheduler(m_slot, this);
+}
+
+void FiberWorkStealingScheduler::awakened(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept
+{
+    const bool stealable = is_stealable(*ctx);
+    if (stealable)
+    {
+        // detached contexts can be attached to the scheduler of any thread in the group
+        ctx->detach();
+    }
+
+    std::size_t ready;
+    {
+        std::lock_guard<decltype(m_rqueue_mutex)> lock(m_rqueue_mutex);
+        m_rqueue.push(ctx, props.get_priority());
+        ready = ++m_ready;
+        if (stealable)
+        {
+            ++m_stealable;
+        }
+    }
+
+    // this thread already has something to run; hand the surplus to an idle peer
+    if (stealable && ready > 1)
+    {
+        m_group.wake_idle_peer(m_slot);
+    }
+}
+
+boost::fibers::context* FiberWorkStealingScheduler::pick_next() noexcept
+{
+    boost::fibers::context* ctx = nullptr;
+    {
+        std::lock_guard<decltype(m_rqueue_mutex)> lock(m_rqueue_mutex);
+        ctx = m_rqueue.pop();
+        if (ctx != nullptr)
+        {
+            --m_ready;
+            if (is_stealable(*ctx))
+            {
+                --m_stealable;
+            }
+        }
+    }
+
+    if (ctx == nullptr)
+    {
+        ctx = m_group.steal(m_slot);
+        if (ctx != nullptr)
+        {
+            DVLOG(20) << "work stealing slot " << m_slot << ": stole fiber " << ctx->get_id();
+        }
+    }
+
+    if (ctx != nullptr && is_stealable(*ctx))
+    {
+        boost::fibers::context::active()->attach(ctx);
+    }
+
+    if (m_stats != nullptr)
+    {
+        if (ctx != nullptr)
+        {
+            m_stats->record_switch(m_ready.load());
+            m_clock.resumed(*m_stats, FiberReadyQueue::bucket_index(properties(ctx).get_priority()));
+        }
+        else
+        {
+            m_clock.idle(*m_stats);
+        }
+    }
+
+    return ctx;
+}
+
+bool FiberWorkStealingScheduler::has_ready_fibers() const noexcept
+{
+    return m_ready.load() != 0;
+}
+
+void FiberWorkStealingScheduler::property_change(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept
+{
+    std::lock_guard<decltype(m_rqueue_mutex)> lock(m_rqueue_mutex);
+
+    // ctx may be running or may have been stolen by a peer; it will be placed correctly on its next awakened()
+    if (!ctx->ready_is_linked())
+    {
+        return;
+    }
+
+    m_rqueue.remove(ctx);
+    m_rqueue.push(ctx, props.get_priority());
+}
+
+bool FiberWorkStealingScheduler::peek_stealable(int& priority)
+{
+    if (m_stealable.load() == 0)
+    {
+        return false;
+    }
+
+    std::lock_guard<decltype(m_rqueue_mutex)> lock(m_rqueue_mutex);
+    auto* ctx = m_rqueue.find_first(is_stealable);
+    if (ctx == nullptr)
+    {
+        return false;
+    }
+    priority = properties(ctx).get_priority();
+    return true;
+}
+
+boost::fibers::context* FiberWorkStealingScheduler::steal()
+{
+    std::lock_guard<decltype(m_rqueue_mutex)> lock(m_rqueue_mutex);
+    auto* ctx = m_rqueue.find_first(is_stealable);
+    if (ctx != nullptr)
+    {
+        m_rqueue.remove(ctx);
+        --m_ready;
+        --m_stealable;
+    }
+    return ctx;
+}
+
+void FiberWorkStealingScheduler::suspend_until(std::chrono::steady_clock::time_point const& time_point) noexcept
+{
+    // publish idleness before checking peers; a peer enqueuing surplus work either observes this thread as idle and
+    // notifies it, or its work is visible here and the thread returns to pick_next to steal it
+    m_idle.store(true);
+    ++m_group.m_idle_count;
+
+    if (!m_group.has_stealable_work(m_slot))
+    {
+        if (m_stats == nullptr)
+        {
+            m_waiter.wait_until(time_point);
+        }
+        else
+        {
+            auto start = std::chrono::steady_clock::now();
+            m_waiter.wait_until(time_point);
+            m_stats->record_idle(std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    --m_group.m_idle_count;
+    m_idle.store(false);
+}
+
+void FiberWorkStealingScheduler::notify() noexcept
+{
+    m_waiter.notify();
+}
+
+}  // namespace srf::internal::system
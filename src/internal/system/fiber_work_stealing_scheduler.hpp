@@ -0,0 +1,144 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "internal/system/fiber_idle_waiter.hpp"
+#include "internal/system/fiber_priority_scheduler.hpp"
+#include "internal/system/fiber_ready_queue.hpp"
+#include "internal/system/fiber_scheduler_stats.hpp"
+
+#include <srf/utils/macros.hpp>
+
+#include <boost/fiber/algo/algorithm.hpp>
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/scheduler.hpp>
+#include <boost/intrusive_ptr.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace srf::internal::system {
+
+class FiberWorkStealingScheduler;
+
+/**
+ * @brief Set of FiberWorkStealingSchedulers which are allowed to steal ready fibers from one another
+ *
+ * Each member occupies a fixed slot and is tagged with the NUMA node of the logical cpu on which its thread runs.
+ * Victims are ordered per thief so that all NUMA-local peers are visited before any remote peer.
+ */
+class FiberWorkStealingGroup final
+{
+  public:
+    FiberWorkStealingGroup(std::vector<std::uint32_t> numa_ids);
+    ~FiberWorkStealingGroup();
+
+    DELETE_COPYABILITY(FiberWorkStealingGroup);
+    DELETE_MOVEABILITY(FiberWorkStealingGroup);
+
+    /**
+     * @brief number of slots in the group
+     */
+    std::size_t size() const;
+
+  private:
+    void register_scheduler(std::size_t slot, FiberWorkStealingScheduler* scheduler);
+
+    // steal the highest priority ready fiber from the peers of slot; NUMA-local peers are exhausted first
+    boost::fibers::context* steal(std::size_t slot);
+
+    // wake one idle peer of slot, preferring NUMA-local peers
+    void wake_idle_peer(std::size_t slot);
+
+    // true if any peer of slot has a ready fiber that can be stolen
+    bool has_stealable_work(std::size_t slot) const;
+
+    struct Member
+    {
+        std::atomic<FiberWorkStealingScheduler*> scheduler{nullptr};
+        boost::intrusive_ptr<FiberWorkStealingScheduler> owner;
+        std::vector<std::size_t> local_peers;
+        std::vector<std::size_t> remote_peers;
+    };
+
+    std::vector<Member> m_members;
+    std::atomic<std::size_t> m_idle_count{0};
+    std::mutex m_mutex;
+
+    friend FiberWorkStealingScheduler;
+};
+
+/**
+ * @brief Priority scheduler whose ready fibers may be stolen by idle peers in a FiberWorkStealingGroup
+ *
+ * The local ready queue keeps the same ordering as FiberPriorityScheduler: higher priorities first and round-robin
+ * within a priority. Pinned contexts (the main and dispatcher fibers of the thread) and fibers which pinned themselves
+ * through FiberPriorityProps::set_pinned are never migrated.
+ */
+class FiberWorkStealingScheduler final : public boost::fibers::algo::algorithm_with_properties<FiberPriorityProps>
+{
+  public:
+    FiberWorkStealingScheduler(FiberWorkStealingGroup& group,
+                               std::size_t slot,
+                               std::chrono::nanoseconds busy_poll_timeout = std::chrono::nanoseconds::zero(),
+                               FiberSchedulerStats* stats                 = nullptr);
+    ~FiberWorkStealingScheduler() final = default;
+
+    DELETE_COPYABILITY(FiberWorkStealingScheduler);
+    DELETE_MOVEABILITY(FiberWorkStealingScheduler);
+
+    void awakened(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept final;
+
+    boost::fibers::context* pick_next() noexcept final;
+
+    bool has_ready_fibers() const noexcept final;
+
+    void property_change(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept final;
+
+    void suspend_until(std::chrono::steady_clock::time_point const& time_point) noexcept final;
+
+    void notify() noexcept final;
+
+  private:
+    // priority of the first ready fiber that may be migrated; returns false if there is none
+    bool peek_stealable(int& priority);
+
+    // unlink and return the first ready fiber that may be migrated
+    boost::fibers::context* steal();
+
+    FiberWorkStealingGroup& m_group;
+    const std::size_t m_slot;
+
+    FiberReadyQueue m_rqueue;
+    std::mutex m_rqueue_mutex;
+    std::atomic<std::size_t> m_ready{0};  // mirrors m_rqueue.size() for lock-free reads
+    std::atomic<std::size_t> m_stealable{0};
+    std::atomic<bool> m_idle{false};
+
+    FiberIdleWaiter m_waiter;
+    FiberSchedulerStats* m_stats;
+    FiberRunClock m_clock;
+
+    friend FiberWorkStealingGroup;
+};
+
+}  // namespace srf::internal::system
@@ -0,0 +1,128 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/system/pinned_thread_pool.hpp"
+
+#include "internal/system/system.hpp"
+
+#include "srf/core/bitmap.hpp"
+#include "srf/exceptions/runtime_error.hpp"
+
+#include <glog/logging.h>
+#include <boost/fiber/future/future.hpp>
+
+#include <ostream>
+#include <utility>
+
+namespace srf::internal::system {
+
+PinnedThreadPool::PinnedThreadPool(std::shared_ptr<System> system) : m_system(std::move(system))
+{
+    CHECK(m_system);
+}
+
+PinnedThreadPool::~PinnedThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+        for (auto& worker : m_workers)
+        {
+            worker->cv.notify_one();
+        }
+    }
+
+    for (auto& worker : m_workers)
+    {
+        DVLOG(10) << "[pinned_thread_pool]: joining tid: " << worker->thread.get_id();
+        worker->thread.join();
+    }
+}
+
+Future<void> PinnedThreadPool::enqueue(std::uint32_t cpu_id, std::function<void()> task)
+{
+    boost::fibers::packaged_task<void()> pkg_task(std::move(task));
+    auto future = pkg_task.get_future();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_shutdown)
+    {
+        LOG(ERROR) << "failed to enqueue work to PinnedThreadPool; PinnedThreadPool is shutting down";
+        throw exceptions::SrfRuntimeError(
+            "failed to enqueue work to PinnedThreadPool; PinnedThreadPool is shutting down");
+    }
+
+    auto& idle = m_idle[cpu_id];
+    if (!idle.empty())
+    {
+        auto* worker = idle.back();
+        idle.pop_back();
+        worker->task     = std::move(pkg_task);
+        worker->has_task = true;
+        ++m_reused;
+        lock.unlock();
+        worker->cv.notify_one();
+        return std::move(future);
+    }
+
+    auto& worker     = m_workers.emplace_back(std::make_unique<Worker>());
+    worker->cpu_id   = cpu_id;
+    worker->task     = std::move(pkg_task);
+    worker->has_task = true;
+    worker->thread =
+        m_system->make_thread("thread_engine", CpuSet(cpu_id), [this, ptr = worker.get()] { main(*ptr); });
+    DVLOG(10) << "[pinned_thread_pool]: created thread " << m_workers.size() << " on cpu_id " << cpu_id;
+    return std::move(future);
+}
+
+void PinnedThreadPool::main(Worker& worker)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        worker.cv.wait(lock, [this, &worker] { return worker.has_task || m_shutdown; });
+        if (!worker.has_task)
+        {
+            break;
+        }
+
+        auto task       = std::move(worker.task);
+        worker.has_task = false;
+        lock.unlock();
+
+        DVLOG(10) << "[pinned_thread_pool; tid=" << std::this_thread::get_id() << "]: executing task";
+        task();
+
+        lock.lock();
+        m_idle[worker.cpu_id].push_back(&worker);
+    }
+    DVLOG(10) << "[pinned_thread_pool; tid=" << std::this_thread::get_id() << "]: exiting primary run loop";
+}
+
+std::size_t PinnedThreadPool::thread_count() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_workers.size();
+}
+
+std::size_t PinnedThreadPool::reused_count() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_reused;
+}
+
+}  // namespace srf::internal::system
@@ -0,0 +1,91 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "srf/types.hpp"
+
+#include <boost/fiber/future/packaged_task.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace srf::internal::system {
+
+class System;
+
+/**
+ * @brief Pool of threads, each pinned to a single logical cpu, which are reused across tasks
+ *
+ * A task enqueued for a cpu runs on an idle thread pinned to that cpu, or on a new thread if none is idle. When the
+ * task completes the thread parks and waits for the next task on the same cpu. Threads are created with
+ * System::make_thread, so affinity, memory binding and thread-local initialization happen once per thread rather
+ * than once per task. Thread-local initializers registered with the System after a thread was created are not applied
+ * to that thread.
+ *
+ * The pool grows to the peak number of concurrent tasks per cpu; threads are joined when the pool is destroyed, which
+ * waits for any running task to complete.
+ */
+class PinnedThreadPool final
+{
+  public:
+    PinnedThreadPool(std::shared_ptr<System> system);
+    ~PinnedThreadPool();
+
+    /**
+     * @brief run task on a thread pinned to cpu_id
+     */
+    Future<void> enqueue(std::uint32_t cpu_id, std::function<void()> task);
+
+    /**
+     * @brief number of threads created by the pool
+     */
+    std::size_t thread_count() const;
+
+    /**
+     * @brief number of tasks which ran on a previously used thread
+     */
+    std::size_t reused_count() const;
+
+  private:
+    struct Worker
+    {
+        std::uint32_t cpu_id;
+        boost::fibers::packaged_task<void()> task;
+        bool has_task{false};
+        std::condition_variable cv;
+        std::thread thread;
+    };
+
+    void main(Worker& worker);
+
+    std::shared_ptr<System> m_system;
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::map<std::uint32_t, std::vector<Worker*>> m_idle;
+    std::size_t m_reused{0};
+    bool m_shutdown{false};
+};
+
+}  // namespace srf::internal::system
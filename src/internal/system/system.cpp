@@ -171,6 +171,12 @@ std::shared_ptr<FiberPool> System::make_fiber_pool(CpuSet cpu_set) const
     return m_fiber_manager->make_pool(cpu_set);
 }
 
+void System::register_metrics(metrics::Registry& registry) const
+{
+    CHECK(m_fiber_manager);
+    m_fiber_manager->register_metrics(registry);
+}
+
 const Partitions& System::partitions() const
 {
     CHECK(m_partitions);
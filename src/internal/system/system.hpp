@@ -74,6 +74,8 @@ class System final
     std::shared_ptr<FiberTaskQueue> get_task_queue(std::uint32_t cpu_id) const;
     std::shared_ptr<FiberPool> make_fiber_pool(CpuSet cpu_set) const;
 
+    void register_metrics(metrics::Registry& registry) const;
+
     template <typename ResourceT>
     void register_thread_local_resource(const CpuSet& cpu_set, std::shared_ptr<ResourceT> resource);
 
@@ -102,10 +104,8 @@ template <typename ResourceT>
 void System::register_thread_local_resource(const CpuSet& cpu_set, std::shared_ptr<ResourceT> resource)
 {
     CHECK(resource);
-    CHECK(topology().contains(cpu_set));
-    auto pool = make_fiber_pool(cpu_set);
-    pool->set_thread_local_resource(resource);
-    register_thread_local_initializer([resource] { ::srf::utils::ThreadLocalSharedPointer<ResourceT>::set(resource); });
+    register_thread_local_initializer(cpu_set,
+                                      [resource] { ::srf::utils::ThreadLocalSharedPointer<ResourceT>::set(resource); });
 }
 
 template <typename CallableT>
@@ -39,6 +39,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 // work-around for known iwyu issue
 // https://github.com/include-what-you-use/include-what-you-use/issues/908
@@ -324,6 +325,44 @@ NumaSet Topology::numaset_for_cpuset(const CpuSet& cpu_set) const
     return numa_set;
 }
 
+std::vector<std::uint32_t> Topology::core_spread_order(const CpuSet& cpu_set) const
+{
+    // group the logical cpus of cpu_set by physical core
+    std::vector<std::vector<std::uint32_t>> cores;
+    CpuSet covered;
+    for (std::uint32_t i = 0; i < core_count(); ++i)
+    {
+        auto core_cpus = cpuset_for_object(m_depth_core, i).set_intersect(cpu_set);
+        if (!core_cpus.empty())
+        {
+            covered.append(core_cpus);
+            cores.push_back(core_cpus.vec());
+        }
+    }
+    for (const auto& cpu : cpu_set.vec())
+    {
+        if (!covered.is_set(cpu))
+        {
+            cores.push_back({cpu});
+        }
+    }
+
+    const std::size_t count = cpu_set.weight();
+    std::vector<std::uint32_t> order;
+    order.reserve(count);
+    for (std::size_t smt = 0; order.size() < count; ++smt)
+    {
+        for (const auto& core : cores)
+        {
+            if (smt < core.size())
+            {
+                order.push_back(core[smt]);
+            }
+        }
+    }
+    return order;
+}
+
 std::uint32_t Topology::gpu_count() const
 {
     return m_gpu_info.size();
@@ -179,6 +179,18 @@ class Topology final
      */
     [[nodiscard]] NumaSet numaset_for_cpuset(const CpuSet& cpu_set) const;
 
+    /**
+     * @brief Logical cpus of cpu_set ordered to spread across physical cores
+     *
+     * The first hardware thread of every physical core in cpu_set is listed before any of the SMT siblings, i.e. the
+     * i-th pass over the cores contributes the i-th logical cpu of each core. Logical cpus not covered by a core object
+     * are treated as cores of their own.
+     *
+     * @param cpu_set
+     * @return std::vector<std::uint32_t>
+     */
+    [[nodiscard]] std::vector<std::uint32_t> core_spread_order(const CpuSet& cpu_set) const;
+
     protos::Topology serialize() const;
 
     static void serialize_to_file(std::string path);
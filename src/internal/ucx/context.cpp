@@ -47,8 +47,8 @@ Context::Context()
     // UCP initialization
     ucp_params.field_mask = UCP_PARAM_FIELD_FEATURES;  // | UCP_PARAM_FIELD_MT_WORKERS_SHARED;
 
-    // add rdma and am flags here
-    ucp_params.features = UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_RMA;
+    // add rdma and am flags here; wakeup enables event driven progress engines via ucp_worker_get_efd
+    ucp_params.features = UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_RMA | UCP_FEATURE_WAKEUP;
 
     // MT_WORKERS_SHARED could be true if the comms and event workers are on different threads
     // ucp_params.mt_workers_shared = 1;
@@ -0,0 +1,135 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/ucx/event_waker.hpp"
+
+#include "internal/system/fiber_idle_waiter.hpp"
+#include "internal/system/fiber_priority_scheduler.hpp"
+
+#include <glog/logging.h>
+#include <poll.h>
+#include <boost/fiber/context.hpp>
+#include <boost/fiber/operations.hpp>
+
+#include <algorithm>
+
+namespace srf::internal::ucx {
+
+// sleep between polls of the descriptor when the thread is not running an srf fiber scheduler
+static constexpr std::chrono::microseconds fallback_poll_interval{100};
+
+namespace {
+
+// keeps the calling fiber on its thread while the descriptor is registered with that thread's idle waiter; without it
+// a work stealing peer could resume the fiber and unwatch from a foreign thread
+class PinFiberGuard
+{
+  public:
+    PinFiberGuard() :
+      m_props(dynamic_cast<system::FiberPriorityProps*>(boost::fibers::context::active()->get_properties()))
+    {
+        if (m_props != nullptr)
+        {
+            m_was_pinned = m_props->is_pinned();
+            m_props->set_pinned(true);
+        }
+    }
+
+    ~PinFiberGuard()
+    {
+        if (m_props != nullptr)
+        {
+            m_props->set_pinned(m_was_pinned);
+        }
+    }
+
+    PinFiberGuard(const PinFiberGuard&)            = delete;
+    PinFiberGuard& operator=(const PinFiberGuard&) = delete;
+
+  private:
+    system::FiberPriorityProps* m_props;
+    bool m_was_pinned{false};
+};
+
+}  // namespace
+
+EventWaker::EventWaker(int fd) : m_fd(fd)
+{
+    CHECK_GE(m_fd, 0);
+}
+
+bool EventWaker::await_event(std::chrono::microseconds timeout)
+{
+    auto* waiter = system::FiberIdleWaiter::current();
+    if (waiter == nullptr)
+    {
+        return poll_event(timeout);
+    }
+
+    PinFiberGuard pin;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_signaled)
+    {
+        waiter->watch(m_fd, [this] { notify(); });
+        m_cv.wait_for(lock, timeout, [this] { return m_signaled; });
+        waiter->unwatch(m_fd);
+    }
+    auto signaled = m_signaled;
+    m_signaled    = false;
+    return signaled;
+}
+
+void EventWaker::notify()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_signaled = true;
+    }
+    m_cv.notify_all();
+}
+
+bool EventWaker::poll_event(std::chrono::microseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    pollfd event{m_fd, POLLIN, 0};
+
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_signaled)
+            {
+                m_signaled = false;
+                return true;
+            }
+        }
+        if (poll(&event, 1, 0) > 0)
+        {
+            return true;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            return false;
+        }
+        boost::this_fiber::sleep_for(
+            std::min<std::chrono::steady_clock::duration>(fallback_poll_interval, deadline - now));
+    }
+}
+
+}  // namespace srf::internal::ucx
@@ -0,0 +1,70 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <boost/fiber/condition_variable.hpp>
+
+#include <chrono>
+#include <mutex>
+
+namespace srf::internal::ucx {
+
+/**
+ * @brief Suspends fibers until a file descriptor becomes readable without blocking the thread running the fibers
+ *
+ * The descriptor is handed to the idle waiter of the fiber scheduler running on the calling thread, so the wait costs
+ * nothing while other fibers are ready and the thread blocks in epoll on the descriptor only once the scheduler is
+ * idle. On threads which do not run an srf fiber scheduler the descriptor is polled between short fiber sleeps. Used
+ * with the event file descriptor of an armed ucx::Worker to sleep a progress engine until network activity arrives.
+ */
+class EventWaker final
+{
+  public:
+    EventWaker(int fd);
+    ~EventWaker() = default;
+
+    EventWaker(const EventWaker&)            = delete;
+    EventWaker& operator=(const EventWaker&) = delete;
+
+    /**
+     * @brief Yield the calling fiber until the descriptor is readable, notify is called or timeout elapses
+     *
+     * A notification which arrived since the previous call completes the call immediately.
+     *
+     * @return true if woken by an event or notification; false on timeout
+     */
+    bool await_event(std::chrono::microseconds timeout);
+
+    /**
+     * @brief Wake the current or next call to await_event; may be called from any thread
+     */
+    void notify();
+
+  private:
+    bool poll_event(std::chrono::microseconds timeout);
+
+    int m_fd;
+    bool m_signaled{false};
+
+    // the event handler runs on the scheduler's dispatcher, which must not suspend on a fiber mutex; the std::mutex is
+    // never held across a suspension point
+    std::mutex m_mutex;
+    boost::fibers::condition_variable_any m_cv;
+};
+
+}  // namespace srf::internal::ucx
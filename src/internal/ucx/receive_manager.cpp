@@ -35,6 +35,14 @@
 
 namespace srf::internal::ucx {
 
+// number of consecutive empty probes before an event driven engine arms the worker and sleeps; spinning briefly keeps
+// receive latency low for bursty traffic without burning a core when idle
+static constexpr std::uint32_t idle_polls_before_sleep = 64;
+
+// upper bound on a single sleep; stop() wakes the engine explicitly. the worker's event fd is only waited on once the
+// scheduler thread has no other ready fibers, so on a busy thread this bounds the latency to the next progress
+static constexpr std::chrono::milliseconds max_event_sleep{10};
+
 TaggedReceiveManager::TaggedReceiveManager(Handle<Worker> worker, ucp_tag_t tag, ucp_tag_t task_mask) :
   m_worker(std::move(worker)),
   m_tag(tag),
@@ -46,18 +54,27 @@ TaggedReceiveManager::~TaggedReceiveManager() = default;
 
 void TaggedReceiveManager::start()
 {
-    m_running           = true;
+    m_running = true;
+    if (m_worker->efd() >= 0)
+    {
+        m_waker = std::make_unique<EventWaker>(m_worker->efd());
+    }
     m_shutdown_complete = boost::fibers::async(::boost::fibers::launch::post, [this] { progress_engine(); });
 }
 
 void TaggedReceiveManager::stop()
 {
     m_running = false;
+    if (m_waker)
+    {
+        m_waker->notify();
+    }
 }
 
 void TaggedReceiveManager::join()
 {
     m_shutdown_complete.get();
+    m_waker.reset();
 }
 
 Worker& TaggedReceiveManager::worker()
@@ -73,7 +90,8 @@ void TaggedReceiveManager::progress_engine()
 {
     ucp_tag_message_h msg;
     ucp_tag_recv_info_t msg_info;
-    std::uint32_t backoff = 1;
+    std::uint32_t backoff    = 1;
+    std::uint32_t idle_polls = 0;
 
     while (true)
     {
@@ -86,13 +104,31 @@ void TaggedReceiveManager::progress_engine()
             }
             while (m_worker->progress() != 0U)
             {
-                backoff = 1;
+                backoff    = 1;
+                idle_polls = 0;
             }
             if (!m_running)
             {
                 return;
             }
 
+            if (m_waker)
+            {
+                if (++idle_polls < idle_polls_before_sleep)
+                {
+                    boost::this_fiber::yield();
+                    continue;
+                }
+                idle_polls = 0;
+
+                // arming fails if events arrived since the last progress; poll again instead of sleeping
+                if (m_worker->arm())
+                {
+                    m_waker->await_event(max_event_sleep);
+                }
+                continue;
+            }
+
             if (backoff < 1048576)
             {
                 backoff = backoff << 1;
@@ -108,7 +144,8 @@ void TaggedReceiveManager::progress_engine()
         }
 
         on_tagged_msg(msg, msg_info);
-        backoff = 0;
+        backoff    = 0;
+        idle_polls = 0;
     }
 }
 
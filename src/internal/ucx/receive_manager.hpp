@@ -18,13 +18,14 @@
 #pragma once
 
 #include "internal/ucx/common.hpp"
+#include "internal/ucx/event_waker.hpp"
 #include "internal/ucx/worker.hpp"
 
 #include <srf/types.hpp>
 
 #include <ucp/api/ucp_def.h>  // for ucp_tag_t, ucp_tag_message_h, ucp_tag_recv_info_t
 
-#include <memory>  // for enable_shared_from_this
+#include <memory>  // for enable_shared_from_this, unique_ptr
 
 namespace srf::internal::ucx {
 
@@ -50,6 +51,13 @@ class TaggedReceiveManager : public std::enable_shared_from_this<TaggedReceiveMa
     Worker& worker();
 
   private:
+    /**
+     * @brief Probe and progress the worker, dispatching tagged messages to on_tagged_msg
+     *
+     * When the worker provides an event fd the engine polls only while there is work; after a run of empty probes it
+     * arms the worker and suspends on an EventWaker until the next network event. Otherwise it polls with an
+     * exponential backoff.
+     */
     void progress_engine();
 
     virtual void on_tagged_msg(ucp_tag_message_h, const ucp_tag_recv_info_t&) = 0;
@@ -58,6 +66,7 @@ class TaggedReceiveManager : public std::enable_shared_from_this<TaggedReceiveMa
     ucp_tag_t m_tag;
     ucp_tag_t m_tag_mask;
 
+    std::unique_ptr<EventWaker> m_waker;  // null if the worker does not support wakeup
     Future<void> m_shutdown_complete;
     mutable Mutex m_mutex;
     bool m_running;
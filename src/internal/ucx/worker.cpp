@@ -80,6 +80,34 @@ unsigned Worker::progress()
     return ucp_worker_progress(m_handle);
 }
 
+int Worker::efd()
+{
+    if (m_efd == -2)
+    {
+        auto status = ucp_worker_get_efd(m_handle, &m_efd);
+        if (status != UCS_OK)
+        {
+            VLOG(5) << "ucp worker does not provide an event fd - " << ucs_status_string(status);
+            m_efd = -1;
+        }
+    }
+    return m_efd;
+}
+
+bool Worker::arm()
+{
+    auto status = ucp_worker_arm(m_handle);
+    if (status == UCS_ERR_BUSY)
+    {
+        return false;
+    }
+    if (status != UCS_OK)
+    {
+        LOG(FATAL) << "ucp_worker_arm failed - " << ucs_status_string(status);
+    }
+    return true;
+}
+
 const std::string& Worker::address()
 {
     if (m_address_pointer == nullptr)
@@ -39,6 +39,19 @@ class Worker : public Primitive<ucp_worker_h>
 
     unsigned progress();
 
+    /**
+     * @brief File descriptor signaled when the worker has events to progress; -1 if the worker does not support
+     * wakeup
+     */
+    int efd();
+
+    /**
+     * @brief Arm the worker so the next event signals efd()
+     *
+     * @return false if events arrived since the worker was last progressed; the caller must progress before sleeping
+     */
+    bool arm();
+
     const std::string& address();
     void release_address();
 
@@ -49,6 +62,7 @@ class Worker : public Primitive<ucp_worker_h>
     std::string m_address;
     ucp_address_t* m_address_pointer;
     std::size_t m_address_length;
+    int m_efd{-2};  // -2 = not yet queried
 };
 
 }  // namespace srf::internal::ucx
@@ -0,0 +1,328 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <srf/codable/compression.hpp>
+
+#include <srf/exceptions/runtime_error.hpp>
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace srf::codable {
+
+namespace {
+
+/**
+ * Block format of the built-in LZ codec; a sequence of
+ *
+ *   token     1 byte: high nibble literal length, low nibble match length - min_match
+ *   literals  literal length bytes; lengths >= 15 continue in additional bytes of 255 terminated by a byte < 255
+ *   offset    2 bytes little-endian distance back into the output; absent in the final, literal-only sequence
+ *   match     extra match length bytes, same continuation scheme as the literal length
+ */
+class LzCompressor final : public Compressor
+{
+  public:
+    static constexpr std::uint32_t lz_id = 1;
+
+    std::uint32_t id() const final
+    {
+        return lz_id;
+    }
+
+    std::size_t max_compressed_bytes(std::size_t bytes) const final
+    {
+        return bytes + bytes / 255 + 16;
+    }
+
+    std::size_t compress(const void* src, std::size_t bytes, void* dst, std::size_t capacity) const final;
+
+    void decompress(const void* src, std::size_t bytes, void* dst, std::size_t uncompressed_bytes) const final;
+
+  private:
+    static constexpr std::size_t min_match   = 4;
+    static constexpr std::size_t max_offset  = 65535;
+    static constexpr std::size_t hash_log    = 12;
+    static constexpr std::size_t tail_length = 5;  // trailing bytes always emitted as literals
+
+    static std::uint32_t read32(const std::uint8_t* ptr)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static std::uint32_t hash(std::uint32_t sequence)
+    {
+        return (sequence * 2654435761U) >> (32 - hash_log);
+    }
+};
+
+// writes a sequence; returns false if the sequence does not fit in [op, end)
+bool write_sequence(std::uint8_t*& op,
+                    const std::uint8_t* end,
+                    const std::uint8_t* literals,
+                    std::size_t literal_length,
+                    std::size_t offset,
+                    std::size_t match_length)
+{
+    auto write_length = [&](std::size_t length) {
+        for (; length >= 255; length -= 255)
+        {
+            if (op == end)
+            {
+                return false;
+            }
+            *op++ = 255;
+        }
+        if (op == end)
+        {
+            return false;
+        }
+        *op++ = static_cast<std::uint8_t>(length);
+        return true;
+    };
+
+    if (op == end)
+    {
+        return false;
+    }
+    auto* token = op++;
+    *token      = static_cast<std::uint8_t>(std::min<std::size_t>(literal_length, 15) << 4);
+    if (literal_length >= 15 && !write_length(literal_length - 15))
+    {
+        return false;
+    }
+    if (static_cast<std::size_t>(end - op) < literal_length)
+    {
+        return false;
+    }
+    std::memcpy(op, literals, literal_length);
+    op += literal_length;
+
+    if (offset == 0)
+    {
+        return true;
+    }
+
+    if (end - op < 2)
+    {
+        return false;
+    }
+    *op++ = static_cast<std::uint8_t>(offset & 0xff);
+    *op++ = static_cast<std::uint8_t>(offset >> 8);
+    *token |= static_cast<std::uint8_t>(std::min<std::size_t>(match_length, 15));
+    return match_length < 15 || write_length(match_length - 15);
+}
+
+std::size_t LzCompressor::compress(const void* src, std::size_t bytes, void* dst, std::size_t capacity) const
+{
+    const auto* input = static_cast<const std::uint8_t*>(src);
+    auto* op          = static_cast<std::uint8_t*>(dst);
+
+    // only report success if the block shrinks
+    const auto* end = op + std::min(capacity, bytes == 0 ? 0 : bytes - 1);
+
+    // positions are stored + 1 so that 0 marks an empty slot; kept off the stack for small fiber stacks
+    thread_local std::array<std::uint32_t, 1U << hash_log> table;
+    table.fill(0);
+
+    std::size_t anchor = 0;
+    std::size_t ip     = 0;
+    if (bytes > min_match + tail_length && bytes <= UINT32_MAX)
+    {
+        const std::size_t match_limit = bytes - tail_length;
+        while (ip + min_match <= match_limit)
+        {
+            auto sequence = read32(input + ip);
+            auto& slot    = table[hash(sequence)];
+            auto ref      = static_cast<std::size_t>(slot);
+            slot          = static_cast<std::uint32_t>(ip + 1);
+
+            if (ref == 0 || ip + 1 - ref > max_offset || read32(input + ref - 1) != sequence)
+            {
+                ++ip;
+                continue;
+            }
+            --ref;
+
+            auto length = min_match;
+            while (ip + length < match_limit && input[ref + length] == input[ip + length])
+            {
+                ++length;
+            }
+
+            if (!write_sequence(op, end, input + anchor, ip - anchor, ip - ref, length - min_match))
+            {
+                return 0;
+            }
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    if (!write_sequence(op, end, input + anchor, bytes - anchor, 0, 0))
+    {
+        return 0;
+    }
+    return op - static_cast<std::uint8_t*>(dst);
+}
+
+void LzCompressor::decompress(const void* src, std::size_t bytes, void* dst, std::size_t uncompressed_bytes) const
+{
+    const auto* ip     = static_cast<const std::uint8_t*>(src);
+    const auto* in_end = ip + bytes;
+    auto* out          = static_cast<std::uint8_t*>(dst);
+    std::size_t op     = 0;
+
+    auto corrupt = []() { throw exceptions::SrfRuntimeError("lz: corrupt compressed block"); };
+
+    auto read_length = [&](std::size_t length) {
+        if (length != 15)
+        {
+            return length;
+        }
+        std::uint8_t next;
+        do
+        {
+            if (ip == in_end)
+            {
+                corrupt();
+            }
+            next = *ip++;
+            length += next;
+        } while (next == 255);
+        return length;
+    };
+
+    while (true)
+    {
+        if (ip == in_end)
+        {
+            corrupt();
+        }
+        const auto token = *ip++;
+
+        auto literal_length = read_length(token >> 4);
+        if (static_cast<std::size_t>(in_end - ip) < literal_length || uncompressed_bytes - op < literal_length)
+        {
+            corrupt();
+        }
+        std::memcpy(out + op, ip, literal_length);
+        ip += literal_length;
+        op += literal_length;
+
+        if (ip == in_end)
+        {
+            break;
+        }
+
+        if (in_end - ip < 2)
+        {
+            corrupt();
+        }
+        std::size_t offset = ip[0] | (static_cast<std::size_t>(ip[1]) << 8);
+        ip += 2;
+        auto match_length = read_length(token & 0x0f) + min_match;
+        if (offset == 0 || offset > op || uncompressed_bytes - op < match_length)
+        {
+            corrupt();
+        }
+
+        // byte-wise copy; matches may overlap their own output
+        const auto* match = out + op - offset;
+        for (std::size_t i = 0; i < match_length; ++i)
+        {
+            out[op + i] = match[i];
+        }
+        op += match_length;
+    }
+
+    if (op != uncompressed_bytes)
+    {
+        corrupt();
+    }
+}
+
+class CompressorRegistry final
+{
+  public:
+    CompressorRegistry()
+    {
+        m_compressors[LzCompressor::lz_id] = std::make_shared<LzCompressor>();
+    }
+
+    void add(std::shared_ptr<const Compressor> compressor)
+    {
+        CHECK(compressor);
+        CHECK_NE(compressor->id(), 0) << "compressor id 0 is reserved for uncompressed blocks";
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        auto [it, inserted] = m_compressors.emplace(compressor->id(), compressor);
+        if (!inserted && it->second != compressor)
+        {
+            throw exceptions::SrfRuntimeError("a different compressor is registered with id " +
+                                              std::to_string(compressor->id()));
+        }
+    }
+
+    std::shared_ptr<const Compressor> find(std::uint32_t id) const
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        auto search = m_compressors.find(id);
+        if (search == m_compressors.end())
+        {
+            throw exceptions::SrfRuntimeError("no compressor registered with id " + std::to_string(id));
+        }
+        return search->second;
+    }
+
+  private:
+    mutable std::mutex m_mutex;
+    std::map<std::uint32_t, std::shared_ptr<const Compressor>> m_compressors;
+};
+
+CompressorRegistry& registry()
+{
+    static CompressorRegistry instance;
+    return instance;
+}
+
+}  // namespace
+
+std::shared_ptr<const Compressor> lz_compressor()
+{
+    return registry().find(LzCompressor::lz_id);
+}
+
+void register_compressor(std::shared_ptr<const Compressor> compressor)
+{
+    registry().add(std::move(compressor));
+}
+
+std::shared_ptr<const Compressor> find_compressor(std::uint32_t id)
+{
+    return registry().find(id);
+}
+
+}  // namespace srf::codable
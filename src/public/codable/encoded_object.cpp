@@ -18,17 +18,26 @@
 #include <srf/codable/encoded_object.hpp>
 
 #include <srf/protos/codable.pb.h>
+#include <srf/codable/compression.hpp>
+#include <srf/codable/flat_descriptor.hpp>
 #include <srf/codable/memory_resources.hpp>
 #include <srf/memory/block.hpp>
+#include <srf/memory/buffer.hpp>
 #include <srf/memory/memory_kind.hpp>
 #include <srf/utils/thread_local_shared_pointer.hpp>
 
 #include <google/protobuf/any.pb.h>
 #include <google/protobuf/message.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>  // for uint64_t
+#include <cstring>
+#include <iterator>
 #include <memory>   // for __shared_ptr_access, shared_ptr
 #include <ostream>  // for operator<<
+#include <string>
+#include <vector>
 
 namespace srf::codable {
 
@@ -70,6 +79,50 @@ static protos::MemoryKind encode_memory_type(memory::memory_kind_type mem_kind)
     return protos::MemoryKind::None;
 }
 
+static memory::buffer<::cuda::memory_location::host> make_host_buffer(std::size_t bytes)
+{
+    auto view = utils::ThreadLocalSharedPointer<codable::MemoryResources>::get()->host_resource_view();
+    return {bytes, view};
+}
+
+static void fill_descriptor(memory::const_block view, protos::RemoteDescriptor& desc)
+{
+    desc.set_remote_address(reinterpret_cast<std::uint64_t>(view.data()));
+    desc.set_remote_bytes(view.bytes());
+    desc.set_memory_kind(encode_memory_type(view.kind()));
+}
+
+// hands out a cleared spare descriptor message, or a new one if there are no spares; the caller takes ownership
+template <typename MessageT>
+static MessageT* take_spare(std::vector<std::unique_ptr<MessageT>>& spares)
+{
+    if (spares.empty())
+    {
+        return new MessageT;  // NOLINT
+    }
+    auto* msg = spares.back().release();
+    spares.pop_back();
+    msg->Clear();
+    return msg;
+}
+
+template <typename MessageT>
+static void keep_spare(std::vector<std::unique_ptr<MessageT>>& spares, MessageT* msg, std::size_t max_spares)
+{
+    std::unique_ptr<MessageT> owned(msg);
+    if (spares.size() < max_spares)
+    {
+        spares.push_back(std::move(owned));
+    }
+}
+
+static bool contains(const memory::blob& blob, const void* ptr)
+{
+    const auto* begin = static_cast<const std::byte*>(blob.data());
+    const auto* addr  = static_cast<const std::byte*>(ptr);
+    return addr >= begin && addr < begin + blob.bytes();
+}
+
 memory::block EncodedObject::decode_descriptor(const protos::RemoteDescriptor& desc)
 {
     return memory::block(
@@ -79,68 +132,391 @@ memory::block EncodedObject::decode_descriptor(const protos::RemoteDescriptor& d
 protos::RemoteDescriptor EncodedObject::encode_descriptor(memory::const_block view)
 {
     protos::RemoteDescriptor desc;
-    desc.set_remote_address(reinterpret_cast<std::uint64_t>(view.data()));
-    desc.set_remote_bytes(view.bytes());
-    desc.set_memory_kind(encode_memory_type(view.kind()));
-
+    fill_descriptor(view, desc);
     return desc;
 }
 
 const protos::EncodedObject& EncodedObject::proto() const
 {
+    materialize();
     return m_proto;
 }
 
+void EncodedObject::materialize() const
+{
+    if (m_flat.empty())
+    {
+        return;
+    }
+    flat::deserialize(m_flat.data(), m_flat.size(), m_proto);
+    m_flat.clear();
+}
+
+flat::EncodedObjectView EncodedObject::flat_view() const
+{
+    DCHECK(!m_flat.empty());
+    return {m_flat.data(), m_flat.size()};
+}
+
 memory::const_block EncodedObject::memory_block(std::size_t idx) const
 {
     DCHECK_LT(idx, descriptor_count());
-    CHECK(m_proto.descriptors().at(idx).has_remote_desc());
-    return decode_descriptor(m_proto.descriptors().at(idx).remote_desc());
+    if (!m_flat.empty())
+    {
+        auto view = flat_view();
+        if (view.kind(idx) == flat::DescriptorKind::Eager)
+        {
+            auto data = view.data(idx);
+            return memory::const_block(data.data(), data.size(), memory::memory_kind_type::host);
+        }
+        CHECK(view.kind(idx) == flat::DescriptorKind::Remote);
+        return memory::const_block(reinterpret_cast<const void*>(view.remote_address(idx)),
+                                   view.remote_bytes(idx),
+                                   decode_memory_type(view.memory_kind(idx)));
+    }
+
+    const auto& desc = m_proto.descriptors().at(idx);
+    if (desc.has_eager_desc())
+    {
+        const auto& data = desc.eager_desc().data();
+        return memory::const_block(data.data(), data.size(), memory::memory_kind_type::host);
+    }
+    CHECK(desc.has_remote_desc());
+    return decode_descriptor(desc.remote_desc());
 }
 
 const protos::EagerDescriptor& EncodedObject::eager_descriptor(std::size_t idx) const
 {
     DCHECK_LT(idx, descriptor_count());
+    materialize();
     CHECK(m_proto.descriptors().at(idx).has_eager_desc());
     return m_proto.descriptors().at(idx).eager_desc();
 }
 
-memory::block EncodedObject::mutable_memory_block(std::size_t idx) const
+memory::block EncodedObject::mutable_memory_block(std::size_t idx)
 {
     CHECK(m_context_acquired);
     DCHECK_LT(idx, descriptor_count());
-    CHECK(m_proto.descriptors().at(idx).has_remote_desc());
-    return decode_descriptor(m_proto.descriptors().at(idx).remote_desc());
+    materialize();
+    auto* desc = m_proto.mutable_descriptors(idx);
+    if (desc->has_eager_desc())
+    {
+        auto* data = desc->mutable_eager_desc()->mutable_data();
+        return memory::block(data->data(), data->size(), memory::memory_kind_type::host);
+    }
+    CHECK(desc->has_remote_desc());
+    return decode_descriptor(desc->remote_desc());
 }
 
 std::size_t EncodedObject::descriptor_count() const
 {
+    if (!m_flat.empty())
+    {
+        return flat_view().descriptor_count();
+    }
     return m_proto.descriptors_size();
 }
 
 std::size_t EncodedObject::object_count() const
 {
+    if (!m_flat.empty())
+    {
+        return flat_view().object_count();
+    }
     return m_proto.objects_size();
 }
 
 std::size_t EncodedObject::type_index_hash_for_object(std::size_t idx) const
 {
     DCHECK_LT(idx, object_count());
+    if (!m_flat.empty())
+    {
+        return flat_view().type_index_hash_for_object(idx);
+    }
     return m_proto.objects().at(idx).type_index_hash();
 }
 
 std::size_t EncodedObject::start_idx_for_object(std::size_t idx) const
 {
     DCHECK_LT(idx, object_count());
+    if (!m_flat.empty())
+    {
+        return flat_view().start_idx_for_object(idx);
+    }
     return m_proto.objects().at(idx).desc_id();
 }
 
+void EncodedObject::reset()
+{
+    CHECK(!m_context_acquired);
+    m_flat.clear();
+
+    // Clear() would delete the oneof sub-messages, so move them to the spares first
+    for (auto& desc : *m_proto.mutable_descriptors())
+    {
+        switch (desc.desc_case())
+        {
+        case protos::Descriptor::kRemoteDesc:
+            keep_spare(m_spares.remote_descs, desc.release_remote_desc(), max_spare_descriptors);
+            break;
+        case protos::Descriptor::kEagerDesc:
+            keep_spare(m_spares.eager_descs, desc.release_eager_desc(), max_spare_descriptors);
+            break;
+        case protos::Descriptor::kMetaDataDesc:
+            keep_spare(m_spares.meta_data_descs, desc.release_meta_data_desc(), max_spare_descriptors);
+            break;
+        default:
+            break;
+        }
+    }
+    m_proto.Clear();
+
+    for (auto& buffer : m_buffers)
+    {
+        auto kind = buffer.blob.kind();
+        if (buffer.blob.use_count() == 1 &&
+            (kind == memory::memory_kind_type::host || kind == memory::memory_kind_type::pinned) &&
+            m_spares.host_buffer_bytes + buffer.blob.bytes() <= max_spare_host_buffer_bytes)
+        {
+            m_spares.host_buffer_bytes += buffer.blob.bytes();
+            m_spares.host_buffers.push_back(std::move(buffer.blob));
+        }
+    }
+    m_buffers.clear();
+    m_slab              = memory::block();
+    m_slab_bytes        = 0;
+    m_eager_threshold   = default_eager_threshold();
+    m_descriptor_format = DescriptorFormat::Protobuf;
+}
+
+std::size_t EncodedObject::eager_threshold() const
+{
+    return m_eager_threshold;
+}
+
+void EncodedObject::set_eager_threshold(std::size_t bytes)
+{
+    m_eager_threshold = bytes;
+}
+
+DescriptorFormat EncodedObject::descriptor_format() const
+{
+    return m_descriptor_format;
+}
+
+void EncodedObject::set_descriptor_format(DescriptorFormat format)
+{
+    m_descriptor_format = format;
+}
+
+std::size_t EncodedObject::serialized_descriptor_bytes() const
+{
+    if (m_descriptor_format == DescriptorFormat::Flat)
+    {
+        return m_flat.empty() ? flat::serialized_size(m_proto) : m_flat.size();
+    }
+    return proto().ByteSizeLong();
+}
+
+std::size_t EncodedObject::serialize_descriptors(void* dst, std::size_t bytes) const
+{
+    if (m_descriptor_format == DescriptorFormat::Flat)
+    {
+        if (m_flat.empty())
+        {
+            return flat::serialize(m_proto, dst, bytes);
+        }
+        CHECK_LE(m_flat.size(), bytes);
+        std::memcpy(dst, m_flat.data(), m_flat.size());
+        return m_flat.size();
+    }
+    CHECK(proto().SerializeToArray(dst, bytes));
+    return m_proto.GetCachedSize();
+}
+
+void EncodedObject::deserialize_descriptors(const void* data, std::size_t bytes)
+{
+    CHECK(!m_context_acquired);
+    reset();
+    if (flat::is_flat(data, bytes))
+    {
+        // validates the header and tables before the copy is read in place
+        flat::EncodedObjectView{data, bytes};
+        m_flat.assign(static_cast<const char*>(data), bytes);
+        m_descriptor_format = DescriptorFormat::Flat;
+        return;
+    }
+    if (!m_proto.ParseFromArray(data, bytes))
+    {
+        throw exceptions::SrfRuntimeError("unable to parse serialized EncodedObject descriptors");
+    }
+}
+
+void EncodedObject::compress_object(std::size_t object_idx, const Compressor& compressor, std::size_t threshold_bytes)
+{
+    CHECK(!m_context_acquired);
+    materialize();
+    std::string scratch;
+
+    for (auto idx = start_idx_for_object(object_idx); idx < end_idx_for_object(object_idx); ++idx)
+    {
+        auto* desc = m_proto.mutable_descriptors(idx);
+
+        if (desc->has_eager_desc())
+        {
+            auto* eager = desc->mutable_eager_desc();
+            auto bytes  = eager->data().size();
+            if (eager->compression() != 0 || bytes < threshold_bytes)
+            {
+                continue;
+            }
+            scratch.resize(compressor.max_compressed_bytes(bytes));
+            auto compressed = compressor.compress(eager->data().data(), bytes, scratch.data(), scratch.size());
+            if (compressed != 0)
+            {
+                scratch.resize(compressed);
+                eager->mutable_data()->swap(scratch);
+                eager->set_compression(compressor.id());
+                eager->set_uncompressed_bytes(bytes);
+            }
+            continue;
+        }
+
+        if (desc->has_remote_desc())
+        {
+            auto* remote = desc->mutable_remote_desc();
+            auto bytes   = remote->remote_bytes();
+            if (remote->compression() != 0 || bytes < threshold_bytes ||
+                (remote->memory_kind() != protos::MemoryKind::Host &&
+                 remote->memory_kind() != protos::MemoryKind::Pinned))
+            {
+                continue;
+            }
+
+            auto buff       = make_host_buffer(compressor.max_compressed_bytes(bytes));
+            const auto* src = reinterpret_cast<const void*>(remote->remote_address());
+            auto compressed = compressor.compress(src, bytes, buff.data(), buff.bytes());
+            if (compressed == 0)
+            {
+                continue;
+            }
+
+            // release the uncompressed copy if it was owned by this EncodedObject
+            release_owned_buffer(src);
+
+            remote->set_remote_address(reinterpret_cast<std::uint64_t>(buff.data()));
+            remote->set_remote_bytes(compressed);
+            remote->set_memory_kind(encode_memory_type(buff.kind()));
+            remote->set_compression(compressor.id());
+            remote->set_uncompressed_bytes(bytes);
+            m_buffers.push_back({std::move(buff), 1});
+        }
+    }
+}
+
+void EncodedObject::release_owned_buffer(const void* ptr)
+{
+    auto owner = std::find_if(
+        m_buffers.rbegin(), m_buffers.rend(), [ptr](const OwnedBuffer& buffer) { return contains(buffer.blob, ptr); });
+    if (owner == m_buffers.rend() || --owner->descriptors > 0)
+    {
+        return;
+    }
+
+    // the remaining tail of a released slab must not be carved again
+    if (contains(owner->blob, m_slab.data()))
+    {
+        m_slab = memory::block();
+    }
+    m_buffers.erase(std::next(owner).base());
+}
+
+bool EncodedObject::is_compressed(std::size_t object_idx) const
+{
+    if (!m_flat.empty())
+    {
+        auto view = flat_view();
+        for (auto idx = start_idx_for_object(object_idx); idx < end_idx_for_object(object_idx); ++idx)
+        {
+            auto kind = view.kind(idx);
+            if ((kind == flat::DescriptorKind::Eager || kind == flat::DescriptorKind::Remote) &&
+                view.compression(idx) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    for (auto idx = start_idx_for_object(object_idx); idx < end_idx_for_object(object_idx); ++idx)
+    {
+        const auto& desc = m_proto.descriptors().at(idx);
+        if ((desc.has_eager_desc() && desc.eager_desc().compression() != 0) ||
+            (desc.has_remote_desc() && desc.remote_desc().compression() != 0))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::unique_ptr<EncodedObject> EncodedObject::decompress_objects(std::size_t first_object, std::size_t count) const
+{
+    DCHECK_LE(first_object + count, object_count());
+    auto decompressed = std::make_unique<EncodedObject>(*this);
+    decompressed->materialize();
+    if (count == 0)
+    {
+        return decompressed;
+    }
+
+    for (auto idx = start_idx_for_object(first_object); idx < end_idx_for_object(first_object + count - 1); ++idx)
+    {
+        auto* desc = decompressed->m_proto.mutable_descriptors(idx);
+
+        if (desc->has_eager_desc() && desc->eager_desc().compression() != 0)
+        {
+            auto* eager     = desc->mutable_eager_desc();
+            auto compressor = find_compressor(eager->compression());
+            std::string data(eager->uncompressed_bytes(), '\0');
+            compressor->decompress(eager->data().data(), eager->data().size(), data.data(), data.size());
+            eager->mutable_data()->swap(data);
+            eager->clear_compression();
+            eager->clear_uncompressed_bytes();
+        }
+        else if (desc->has_remote_desc() && desc->remote_desc().compression() != 0)
+        {
+            auto* remote    = desc->mutable_remote_desc();
+            auto compressor = find_compressor(remote->compression());
+            auto buff       = make_host_buffer(remote->uncompressed_bytes());
+            compressor->decompress(reinterpret_cast<const void*>(remote->remote_address()),
+                                   remote->remote_bytes(),
+                                   buff.data(),
+                                   buff.bytes());
+            remote->set_remote_address(reinterpret_cast<std::uint64_t>(buff.data()));
+            remote->set_remote_bytes(buff.bytes());
+            remote->set_memory_kind(encode_memory_type(buff.kind()));
+            remote->clear_compression();
+            remote->clear_uncompressed_bytes();
+            decompressed->m_buffers.push_back({std::move(buff), 1});
+        }
+    }
+
+    return decompressed;
+}
+
 std::size_t EncodedObject::add_meta_data(const google::protobuf::Message& meta_data)
 {
     CHECK(m_context_acquired);
     auto index = m_proto.descriptors_size();
-    auto* desc = m_proto.add_descriptors();
-    desc->mutable_meta_data_desc()->mutable_meta_data()->PackFrom(meta_data);
+    auto* desc = take_spare(m_spares.meta_data_descs);
+
+    // equivalent to Any::PackFrom, which would build the type url in a temporary string
+    auto* any = desc->mutable_meta_data();
+    any->mutable_type_url()->assign("type.googleapis.com/").append(meta_data.GetDescriptor()->full_name());
+    meta_data.SerializeToString(any->mutable_value());
+
+    m_proto.add_descriptors()->set_allocated_meta_data_desc(desc);
     return index;
 }
 
@@ -148,16 +524,70 @@ std::size_t EncodedObject::add_memory_block(memory::const_block view)
 {
     CHECK(m_context_acquired);
     auto count = descriptor_count();
-    auto* desc = m_proto.add_descriptors()->mutable_remote_desc();
-    *desc      = encode_descriptor(view);
+    auto* desc = take_spare(m_spares.remote_descs);
+    fill_descriptor(view, *desc);
+    m_proto.add_descriptors()->set_allocated_remote_desc(desc);
     return count;
 }
 
 std::size_t EncodedObject::add_host_buffer(std::size_t bytes)
 {
     CHECK(m_context_acquired);
-    auto view = utils::ThreadLocalSharedPointer<codable::MemoryResources>::get()->host_resource_view();
-    return add_buffer(view, bytes);
+    if (bytes <= max_coalesced_buffer_bytes)
+    {
+        return add_coalesced_host_buffer(bytes);
+    }
+    auto buffer = take_host_buffer(bytes);
+    auto index  = add_memory_block(memory::const_block(buffer.data(), bytes, buffer.kind()));
+    m_buffers.push_back({std::move(buffer), 1});
+    return index;
+}
+
+memory::blob EncodedObject::take_host_buffer(std::size_t bytes)
+{
+    auto& spares = m_spares.host_buffers;
+    auto best    = spares.end();
+    for (auto it = spares.begin(); it != spares.end(); ++it)
+    {
+        if (it->bytes() >= bytes && (best == spares.end() || it->bytes() < best->bytes()))
+        {
+            best = it;
+        }
+    }
+    if (best == spares.end())
+    {
+        return make_host_buffer(bytes);
+    }
+
+    auto buffer = std::move(*best);
+    spares.erase(best);
+    m_spares.host_buffer_bytes -= buffer.bytes();
+    return buffer;
+}
+
+std::size_t EncodedObject::add_coalesced_host_buffer(std::size_t bytes)
+{
+    constexpr std::size_t alignment = alignof(std::max_align_t);
+    const auto aligned_bytes        = (bytes + alignment - 1) & ~(alignment - 1);
+
+    if (m_slab.bytes() < aligned_bytes)
+    {
+        auto buff    = take_host_buffer(std::clamp(2 * m_slab_bytes, aligned_bytes, coalesced_slab_bytes));
+        m_slab       = memory::block(buff.data(), buff.bytes(), buff.kind());
+        m_slab_bytes = buff.bytes();
+        m_buffers.push_back({std::move(buff), 0});
+    }
+
+    // the slab is the owned buffer holding the current tail
+    auto* data = m_slab.data();
+    auto kind  = m_slab.kind();
+    auto slab  = std::find_if(
+        m_buffers.rbegin(), m_buffers.rend(), [data](const OwnedBuffer& buffer) { return contains(buffer.blob, data); });
+    DCHECK(slab != m_buffers.rend());
+    ++slab->descriptors;
+
+    m_slab = memory::block(static_cast<std::byte*>(data) + aligned_bytes, m_slab.bytes() - aligned_bytes, kind);
+    return add_memory_block(memory::const_block(data, bytes, kind));
 }
 
 std::size_t EncodedObject::add_device_buffer(std::size_t bytes)
@@ -170,16 +600,42 @@ std::size_t EncodedObject::add_device_buffer(std::size_t bytes)
 std::size_t EncodedObject::add_eager_buffer(const void* data, std::size_t bytes)
 {
     CHECK(m_context_acquired);
-    auto count                    = descriptor_count();
-    protos::EagerDescriptor* desc = m_proto.add_descriptors()->mutable_eager_desc();
-    desc->set_data(data, bytes);
+    auto count = descriptor_count();
+    auto* desc = take_spare(m_spares.eager_descs);
+    desc->mutable_data()->assign(static_cast<const char*>(data), bytes);
+    m_proto.add_descriptors()->set_allocated_eager_desc(desc);
     return count;
 }
 
+std::size_t EncodedObject::add_host_block(memory::const_block view)
+{
+    CHECK(m_context_acquired);
+    if (view.bytes() <= m_eager_threshold)
+    {
+        return add_eager_buffer(view.data(), view.bytes());
+    }
+    return add_memory_block(view);
+}
+
+std::size_t EncodedObject::add_payload_buffer(std::size_t bytes)
+{
+    CHECK(m_context_acquired);
+    if (bytes <= m_eager_threshold)
+    {
+        auto count = descriptor_count();
+        auto* desc = take_spare(m_spares.eager_descs);
+        desc->mutable_data()->resize(bytes);
+        m_proto.add_descriptors()->set_allocated_eager_desc(desc);
+        return count;
+    }
+    return add_host_buffer(bytes);
+}
+
 EncodedObject::ContextGuard::ContextGuard(EncodedObject& encoded_object, std::type_index type_index) :
   m_encoded_object(encoded_object)
 {
     CHECK(m_encoded_object.m_context_acquired == false);
+    m_encoded_object.materialize();
     m_encoded_object.m_context_acquired = true;
     m_encoded_object.add_type_index(type_index);
 }
@@ -190,6 +646,16 @@ EncodedObject::ContextGuard::~ContextGuard()
     m_encoded_object.m_context_acquired = false;
 }
 
+std::size_t EncodedObject::end_idx_for_object(std::size_t object_idx) const
+{
+    DCHECK_LT(object_idx, object_count());
+    if (object_idx + 1 < object_count())
+    {
+        return start_idx_for_object(object_idx + 1);
+    }
+    return descriptor_count();
+}
+
 void EncodedObject::add_type_index(std::type_index type_index)
 {
     CHECK(m_context_acquired);
@@ -0,0 +1,114 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <srf/codable/encoded_object_pool.hpp>
+
+#include <srf/codable/encoded_object.hpp>
+
+#include <glog/logging.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace srf::codable {
+
+namespace {
+
+constexpr std::size_t max_pooled_objects = 64;
+
+// trivially destructible, so it remains readable after the pool itself has been destroyed during thread exit
+thread_local bool tl_pool_destroyed = false;  // NOLINT
+
+class ThreadLocalPool final
+{
+  public:
+    ThreadLocalPool()
+    {
+        m_objects.reserve(max_pooled_objects);
+    }
+
+    ~ThreadLocalPool()
+    {
+        tl_pool_destroyed = true;
+    }
+
+    std::unique_ptr<EncodedObject> pop()
+    {
+        if (m_objects.empty())
+        {
+            return std::make_unique<EncodedObject>();
+        }
+        auto encoded_object = std::move(m_objects.back());
+        m_objects.pop_back();
+        return encoded_object;
+    }
+
+    void push(std::unique_ptr<EncodedObject> encoded_object)
+    {
+        if (m_objects.size() < max_pooled_objects)
+        {
+            m_objects.push_back(std::move(encoded_object));
+        }
+    }
+
+    std::size_t size() const
+    {
+        return m_objects.size();
+    }
+
+  private:
+    std::vector<std::unique_ptr<EncodedObject>> m_objects;
+};
+
+ThreadLocalPool& thread_local_pool()
+{
+    thread_local ThreadLocalPool pool;
+    return pool;
+}
+
+}  // namespace
+
+void EncodedObjectPool::Releaser::operator()(EncodedObject* encoded_object) const
+{
+    std::unique_ptr<EncodedObject> owned(encoded_object);
+    if (owned == nullptr || tl_pool_destroyed)
+    {
+        return;
+    }
+    owned->reset();
+    thread_local_pool().push(std::move(owned));
+}
+
+EncodedObjectPool::handle_type EncodedObjectPool::acquire()
+{
+    auto encoded_object = thread_local_pool().pop();
+    DCHECK_EQ(encoded_object->descriptor_count(), 0);
+    return handle_type(encoded_object.release());
+}
+
+std::size_t EncodedObjectPool::size()
+{
+    return thread_local_pool().size();
+}
+
+std::size_t EncodedObjectPool::capacity()
+{
+    return max_pooled_objects;
+}
+
+}  // namespace srf::codable
@@ -0,0 +1,46 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <srf/codable/encoding_options.hpp>
+
+#include <srf/constants.hpp>
+
+#include <atomic>
+
+namespace srf::codable {
+
+namespace {
+
+std::atomic<std::size_t>& eager_threshold_default()
+{
+    static std::atomic<std::size_t> bytes{SRF_MAX_EAGER_BUFFER_SIZE};
+    return bytes;
+}
+
+}  // namespace
+
+std::size_t default_eager_threshold()
+{
+    return eager_threshold_default().load(std::memory_order_relaxed);
+}
+
+void set_default_eager_threshold(std::size_t bytes)
+{
+    eager_threshold_default().store(bytes, std::memory_order_relaxed);
+}
+
+}  // namespace srf::codable
@@ -0,0 +1,377 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <srf/codable/flat_descriptor.hpp>
+
+#include <srf/protos/codable.pb.h>
+#include <srf/exceptions/runtime_error.hpp>
+#include <srf/utils/little_endian.hpp>
+
+#include <glog/logging.h>
+#include <google/protobuf/any.pb.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace srf::codable::flat {
+
+namespace {
+
+// header field offsets
+constexpr std::size_t header_magic          = 0;
+constexpr std::size_t header_version        = 4;
+constexpr std::size_t header_flags          = 6;
+constexpr std::size_t header_descriptors    = 8;
+constexpr std::size_t header_objects        = 12;
+constexpr std::size_t header_meta_data_off  = 16;
+constexpr std::size_t header_meta_data_size = 24;
+
+constexpr std::uint16_t flag_has_meta_data = 0x1;
+
+// object field offsets
+constexpr std::size_t object_type_index_hash = 0;
+constexpr std::size_t object_desc_id         = 8;
+
+// descriptor field offsets
+constexpr std::size_t desc_kind        = 0;
+constexpr std::size_t desc_memory_kind = 1;
+constexpr std::size_t desc_id          = 4;
+constexpr std::size_t desc_object_id   = 8;
+constexpr std::size_t desc_data_bytes  = 12;
+constexpr std::size_t desc_address     = 16;
+constexpr std::size_t desc_bytes       = 24;
+constexpr std::size_t desc_data_offset = 32;
+constexpr std::size_t desc_compression = 40;
+constexpr std::size_t desc_raw_bytes   = 48;
+
+using utils::little_endian::load;
+using utils::little_endian::store;
+
+std::size_t tables_bytes(std::size_t descriptor_count, std::size_t object_count)
+{
+    return header_bytes + object_count * object_bytes + descriptor_count * descriptor_bytes;
+}
+
+std::size_t variable_bytes(const protos::Descriptor& desc)
+{
+    switch (desc.desc_case())
+    {
+    case protos::Descriptor::kRemoteDesc:
+        return desc.remote_desc().remote_key().size();
+    case protos::Descriptor::kEagerDesc:
+        return desc.eager_desc().data().size();
+    case protos::Descriptor::kMetaDataDesc:
+        return desc.meta_data_desc().meta_data().ByteSizeLong();
+    default:
+        return 0;
+    }
+}
+
+// appends bytes to the data section and records the location in the descriptor at slot
+std::size_t write_data(std::byte* base, std::byte* slot, std::size_t offset, const std::string& data)
+{
+    std::memcpy(base + offset, data.data(), data.size());
+    store<std::uint32_t>(slot + desc_data_bytes, data.size());
+    store<std::uint64_t>(slot + desc_data_offset, offset);
+    return offset + data.size();
+}
+
+}  // namespace
+
+std::size_t serialized_size(const protos::EncodedObject& proto)
+{
+    auto bytes = tables_bytes(proto.descriptors_size(), proto.objects_size());
+    for (const auto& desc : proto.descriptors())
+    {
+        bytes += variable_bytes(desc);
+    }
+    if (proto.has_meta_data())
+    {
+        bytes += proto.meta_data().ByteSizeLong();
+    }
+    return bytes;
+}
+
+std::size_t serialize(const protos::EncodedObject& proto, void* dst, std::size_t bytes)
+{
+    CHECK_GE(bytes, serialized_size(proto));
+    auto* base = static_cast<std::byte*>(dst);
+
+    auto offset = tables_bytes(proto.descriptors_size(), proto.objects_size());
+    std::memset(base, 0, offset);
+
+    store<std::uint32_t>(base + header_magic, magic);
+    store<std::uint16_t>(base + header_version, version);
+    store<std::uint32_t>(base + header_descriptors, proto.descriptors_size());
+    store<std::uint32_t>(base + header_objects, proto.objects_size());
+
+    auto* slot = base + header_bytes;
+    for (const auto& obj : proto.objects())
+    {
+        store<std::uint64_t>(slot + object_type_index_hash, obj.type_index_hash());
+        store<std::uint32_t>(slot + object_desc_id, obj.desc_id());
+        slot += object_bytes;
+    }
+
+    for (const auto& desc : proto.descriptors())
+    {
+        switch (desc.desc_case())
+        {
+        case protos::Descriptor::kRemoteDesc: {
+            const auto& remote = desc.remote_desc();
+            store<std::uint8_t>(slot + desc_kind, static_cast<std::uint8_t>(DescriptorKind::Remote));
+            store<std::uint8_t>(slot + desc_memory_kind, remote.memory_kind());
+            store<std::uint32_t>(slot + desc_id, remote.instance_id());
+            store<std::uint32_t>(slot + desc_object_id, remote.object_id());
+            store<std::uint64_t>(slot + desc_address, remote.remote_address());
+            store<std::uint64_t>(slot + desc_bytes, remote.remote_bytes());
+            store<std::uint32_t>(slot + desc_compression, remote.compression());
+            store<std::uint64_t>(slot + desc_raw_bytes, remote.uncompressed_bytes());
+            offset = write_data(base, slot, offset, remote.remote_key());
+            break;
+        }
+        case protos::Descriptor::kPackedDesc: {
+            const auto& packed = desc.packed_desc();
+            store<std::uint8_t>(slot + desc_kind, static_cast<std::uint8_t>(DescriptorKind::Packed));
+            store<std::uint8_t>(slot + desc_memory_kind, packed.memory_kind());
+            store<std::uint32_t>(slot + desc_id, packed.buffer_id());
+            store<std::uint64_t>(slot + desc_address, packed.remote_address());
+            store<std::uint64_t>(slot + desc_bytes, packed.remote_bytes());
+            break;
+        }
+        case protos::Descriptor::kEagerDesc: {
+            const auto& eager = desc.eager_desc();
+            store<std::uint8_t>(slot + desc_kind, static_cast<std::uint8_t>(DescriptorKind::Eager));
+            store<std::uint8_t>(slot + desc_memory_kind, eager.memory_kind());
+            store<std::uint64_t>(slot + desc_bytes, eager.data().size());
+            store<std::uint32_t>(slot + desc_compression, eager.compression());
+            store<std::uint64_t>(slot + desc_raw_bytes, eager.uncompressed_bytes());
+            offset = write_data(base, slot, offset, eager.data());
+            break;
+        }
+        case protos::Descriptor::kMetaDataDesc: {
+            const auto& any = desc.meta_data_desc().meta_data();
+            auto any_bytes  = any.ByteSizeLong();
+            store<std::uint8_t>(slot + desc_kind, static_cast<std::uint8_t>(DescriptorKind::MetaData));
+            store<std::uint32_t>(slot + desc_data_bytes, any_bytes);
+            store<std::uint64_t>(slot + desc_data_offset, offset);
+            any.SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t*>(base + offset));
+            offset += any_bytes;
+            break;
+        }
+        default:
+            LOG(FATAL) << "unhandled protos::Descriptor type";
+        }
+        slot += descriptor_bytes;
+    }
+
+    if (proto.has_meta_data())
+    {
+        auto any_bytes = proto.meta_data().ByteSizeLong();
+        store<std::uint16_t>(base + header_flags, flag_has_meta_data);
+        store<std::uint64_t>(base + header_meta_data_off, offset);
+        store<std::uint64_t>(base + header_meta_data_size, any_bytes);
+        proto.meta_data().SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t*>(base + offset));
+        offset += any_bytes;
+    }
+
+    return offset;
+}
+
+void deserialize(const void* data, std::size_t bytes, protos::EncodedObject& proto)
+{
+    EncodedObjectView view(data, bytes);
+    proto.Clear();
+
+    for (std::size_t i = 0; i < view.object_count(); ++i)
+    {
+        auto* obj = proto.add_objects();
+        obj->set_type_index_hash(view.type_index_hash_for_object(i));
+        obj->set_desc_id(view.start_idx_for_object(i));
+    }
+
+    for (std::size_t i = 0; i < view.descriptor_count(); ++i)
+    {
+        auto* desc = proto.add_descriptors();
+        switch (view.kind(i))
+        {
+        case DescriptorKind::Remote: {
+            auto* remote = desc->mutable_remote_desc();
+            remote->set_memory_kind(view.memory_kind(i));
+            remote->set_instance_id(view.id(i));
+            remote->set_object_id(view.object_id(i));
+            remote->set_remote_address(view.remote_address(i));
+            remote->set_remote_bytes(view.remote_bytes(i));
+            remote->set_compression(view.compression(i));
+            remote->set_uncompressed_bytes(view.uncompressed_bytes(i));
+            auto key = view.data(i);
+            remote->set_remote_key(key.data(), key.size());
+            break;
+        }
+        case DescriptorKind::Packed: {
+            auto* packed = desc->mutable_packed_desc();
+            packed->set_memory_kind(view.memory_kind(i));
+            packed->set_buffer_id(view.id(i));
+            packed->set_remote_address(view.remote_address(i));
+            packed->set_remote_bytes(view.remote_bytes(i));
+            break;
+        }
+        case DescriptorKind::Eager: {
+            auto* eager = desc->mutable_eager_desc();
+            eager->set_memory_kind(view.memory_kind(i));
+            eager->set_compression(view.compression(i));
+            eager->set_uncompressed_bytes(view.uncompressed_bytes(i));
+            auto payload = view.data(i);
+            eager->set_data(payload.data(), payload.size());
+            break;
+        }
+        case DescriptorKind::MetaData: {
+            auto any = view.data(i);
+            if (!desc->mutable_meta_data_desc()->mutable_meta_data()->ParseFromArray(any.data(), any.size()))
+            {
+                throw exceptions::SrfRuntimeError("flat descriptor: unable to parse meta data");
+            }
+            break;
+        }
+        }
+    }
+
+    auto* base = static_cast<const std::byte*>(data);
+    if ((load<std::uint16_t>(base + header_flags) & flag_has_meta_data) != 0)
+    {
+        auto offset = load<std::uint64_t>(base + header_meta_data_off);
+        auto size   = load<std::uint64_t>(base + header_meta_data_size);
+        if (offset > bytes || size > bytes - offset || !proto.mutable_meta_data()->ParseFromArray(base + offset, size))
+        {
+            throw exceptions::SrfRuntimeError("flat descriptor: unable to parse object meta data");
+        }
+    }
+}
+
+bool is_flat(const void* data, std::size_t bytes)
+{
+    return bytes >= header_bytes && load<std::uint32_t>(static_cast<const std::byte*>(data) + header_magic) == magic;
+}
+
+EncodedObjectView::EncodedObjectView(const void* data, std::size_t bytes) :
+  m_data(static_cast<const std::byte*>(data)),
+  m_bytes(bytes)
+{
+    if (!is_flat(data, bytes))
+    {
+        throw exceptions::SrfRuntimeError("flat descriptor: invalid header");
+    }
+    if (load<std::uint16_t>(m_data + header_version) != version)
+    {
+        throw exceptions::SrfRuntimeError("flat descriptor: unsupported version");
+    }
+    m_descriptor_count = load<std::uint32_t>(m_data + header_descriptors);
+    m_object_count     = load<std::uint32_t>(m_data + header_objects);
+    if (tables_bytes(m_descriptor_count, m_object_count) > m_bytes)
+    {
+        throw exceptions::SrfRuntimeError("flat descriptor: truncated descriptor tables");
+    }
+}
+
+std::size_t EncodedObjectView::descriptor_count() const
+{
+    return m_descriptor_count;
+}
+
+std::size_t EncodedObjectView::object_count() const
+{
+    return m_object_count;
+}
+
+std::size_t EncodedObjectView::type_index_hash_for_object(std::size_t object_idx) const
+{
+    DCHECK_LT(object_idx, m_object_count);
+    return load<std::uint64_t>(m_data + header_bytes + object_idx * object_bytes + object_type_index_hash);
+}
+
+std::size_t EncodedObjectView::start_idx_for_object(std::size_t object_idx) const
+{
+    DCHECK_LT(object_idx, m_object_count);
+    return load<std::uint32_t>(m_data + header_bytes + object_idx * object_bytes + object_desc_id);
+}
+
+DescriptorKind EncodedObjectView::kind(std::size_t idx) const
+{
+    auto kind = load<std::uint8_t>(descriptor(idx) + desc_kind);
+    if (kind < static_cast<std::uint8_t>(DescriptorKind::Remote) ||
+        kind > static_cast<std::uint8_t>(DescriptorKind::MetaData))
+    {
+        throw exceptions::SrfRuntimeError("flat descriptor: unknown descriptor kind");
+    }
+    return static_cast<DescriptorKind>(kind);
+}
+
+protos::MemoryKind EncodedObjectView::memory_kind(std::size_t idx) const
+{
+    return static_cast<protos::MemoryKind>(load<std::uint8_t>(descriptor(idx) + desc_memory_kind));
+}
+
+std::uint32_t EncodedObjectView::id(std::size_t idx) const
+{
+    return load<std::uint32_t>(descriptor(idx) + desc_id);
+}
+
+std::uint32_t EncodedObjectView::object_id(std::size_t idx) const
+{
+    return load<std::uint32_t>(descriptor(idx) + desc_object_id);
+}
+
+std::uint64_t EncodedObjectView::remote_address(std::size_t idx) const
+{
+    return load<std::uint64_t>(descriptor(idx) + desc_address);
+}
+
+std::uint64_t EncodedObjectView::remote_bytes(std::size_t idx) const
+{
+    return load<std::uint64_t>(descriptor(idx) + desc_bytes);
+}
+
+std::string_view EncodedObjectView::data(std::size_t idx) const
+{
+    const auto* slot = descriptor(idx);
+    auto offset      = load<std::uint64_t>(slot + desc_data_offset);
+    auto size        = load<std::uint32_t>(slot + desc_data_bytes);
+    if (offset > m_bytes || size > m_bytes - offset)
+    {
+        throw exceptions::SrfRuntimeError("flat descriptor: data out of bounds");
+    }
+    return {reinterpret_cast<const char*>(m_data + offset), size};
+}
+
+std::uint32_t EncodedObjectView::compression(std::size_t idx) const
+{
+    return load<std::uint32_t>(descriptor(idx) + desc_compression);
+}
+
+std::uint64_t EncodedObjectView::uncompressed_bytes(std::size_t idx) const
+{
+    return load<std::uint64_t>(descriptor(idx) + desc_raw_bytes);
+}
+
+const std::byte* EncodedObjectView::descriptor(std::size_t idx) const
+{
+    DCHECK_LT(idx, m_descriptor_count);
+    return m_data + tables_bytes(0, m_object_count) + idx * descriptor_bytes;
+}
+
+}  // namespace srf::codable::flat
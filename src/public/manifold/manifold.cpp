@@ -25,6 +25,9 @@
 
 #include <glog/logging.h>
 
+#include <cstddef>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -46,6 +49,42 @@ pipeline::Resources& Manifold::resources()
     return m_resources;
 }
 
+void Manifold::drop_output(const SegmentAddress& address)
+{
+    DVLOG(3) << "manifold " << this->port_name() << ": dropping downstream segment " << segment::info(address);
+    do_drop_output(address);
+}
+
+void Manifold::set_segment_resources(const SegmentAddress& address, pipeline::Resources& resources)
+{
+    DVLOG(10) << "manifold " << this->port_name() << ": segment " << segment::info(address)
+              << " is on host partition " << resources.host_partition_id();
+    std::lock_guard<decltype(m_segment_resources_mutex)> lock(m_segment_resources_mutex);
+    m_segment_resources[address] = &resources;
+}
+
+pipeline::Resources& Manifold::resources(const SegmentAddress& address)
+{
+    std::lock_guard<decltype(m_segment_resources_mutex)> lock(m_segment_resources_mutex);
+    auto search = m_segment_resources.find(address);
+    if (search == m_segment_resources.end())
+    {
+        return m_resources;
+    }
+    return *search->second;
+}
+
+std::optional<std::size_t> Manifold::host_partition(const SegmentAddress& address) const
+{
+    std::lock_guard<decltype(m_segment_resources_mutex)> lock(m_segment_resources_mutex);
+    auto search = m_segment_resources.find(address);
+    if (search == m_segment_resources.end())
+    {
+        return std::nullopt;
+    }
+    return search->second->host_partition_id();
+}
+
 void Manifold::add_input(const SegmentAddress& address, node::SourcePropertiesBase* input_source)
 {
     DVLOG(3) << "manifold " << this->port_name() << ": connecting to upstream segment " << segment::info(address);
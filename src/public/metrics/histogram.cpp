@@ -0,0 +1,38 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <srf/metrics/histogram.hpp>
+
+#include <prometheus/histogram.h>
+
+#include <vector>
+
+namespace srf::metrics {
+
+Histogram::Histogram(prometheus::Histogram* histogram) : m_histogram(histogram) {}
+
+void Histogram::observe(double value)
+{
+    m_histogram->Observe(value);
+}
+
+void Histogram::observe_multiple(const std::vector<double>& bucket_increments, double sum_of_values)
+{
+    m_histogram->ObserveMultiple(bucket_increments, sum_of_values);
+}
+
+}  // namespace srf::metrics
@@ -22,10 +22,15 @@
 #include <prometheus/client_metric.h>
 #include <prometheus/counter.h>
 #include <prometheus/family.h>
+#include <prometheus/gauge.h>
+#include <prometheus/histogram.h>
 #include <prometheus/registry.h>
+#include <prometheus/text_serializer.h>
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -38,15 +43,75 @@ Registry::Registry() :
                             .Name("srf_throughput_counters")
                             .Help("number of data elements passing thru a given pipeline object")
                             .Register(*m_registry))
-{}
+{
+    m_counter_families["srf_throughput_counters"] = &m_throughput_counters;
+}
 
 Counter Registry::make_counter(std::string name, std::map<std::string, std::string> labels)
 {
-    auto& family  = prometheus::BuildCounter().Name(std::move(name)).Register(*m_registry);
-    auto& counter = family.Add(std::move(labels));
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& family = m_counter_families[name];
+    if (family == nullptr)
+    {
+        family = &prometheus::BuildCounter().Name(std::move(name)).Register(*m_registry);
+    }
+    auto& counter = family->Add(std::move(labels));
     return Counter(&counter);
 }
 
+Gauge Registry::make_gauge(std::string name, std::map<std::string, std::string> labels)
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& family = m_gauge_families[name];
+    if (family == nullptr)
+    {
+        family = &prometheus::BuildGauge().Name(std::move(name)).Register(*m_registry);
+    }
+    auto& gauge = family->Add(std::move(labels));
+    return Gauge(&gauge);
+}
+
+Histogram Registry::make_histogram(std::string name,
+                                   std::map<std::string, std::string> labels,
+                                   std::vector<double> bucket_boundaries)
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& family = m_histogram_families[name];
+    if (family == nullptr)
+    {
+        family = &prometheus::BuildHistogram().Name(std::move(name)).Register(*m_registry);
+    }
+    auto& histogram = family->Add(std::move(labels), std::move(bucket_boundaries));
+    return Histogram(&histogram);
+}
+
+void Registry::add_collector(std::function<void()> collector)
+{
+    CHECK(collector);
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    m_collectors.push_back(std::move(collector));
+}
+
+void Registry::run_collectors() const
+{
+    // collectors may create metrics, so they are run without holding the lock
+    std::vector<std::function<void()>> collectors;
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        collectors = m_collectors;
+    }
+    for (const auto& collector : collectors)
+    {
+        collector();
+    }
+}
+
+std::string Registry::export_text() const
+{
+    run_collectors();
+    return prometheus::TextSerializer().Serialize(m_registry->Collect());
+}
+
 Counter Registry::make_throughput_counter(std::string name)
 {
     auto& counter = m_throughput_counters.Add({{"name", name}});
@@ -87,4 +87,14 @@ void EngineGroups::set_default_engine_type(runnable::EngineType engine_type)
     m_default_engine_type = engine_type;
 }
 
+EnginePlacement EngineGroups::default_engine_placement() const
+{
+    return m_default_engine_placement;
+}
+
+void EngineGroups::set_default_engine_placement(EnginePlacement placement)
+{
+    m_default_engine_placement = placement;
+}
+
 }  // namespace srf
@@ -17,6 +17,8 @@
 
 #include <srf/options/fiber_pool.hpp>
 
+#include <cstddef>
+
 namespace srf {
 
 FiberPoolOptions& FiberPoolOptions::enable_memory_binding(bool default_true)
@@ -34,6 +36,36 @@ FiberPoolOptions& FiberPoolOptions::enable_tracing_scheduler(bool default_false)
     m_enable_tracing_scheduler = false;
     return *this;
 }
+FiberPoolOptions& FiberPoolOptions::enable_work_stealing(bool default_false)
+{
+    m_enable_work_stealing = default_false;
+    return *this;
+}
+FiberPoolOptions& FiberPoolOptions::enable_deadline_scheduling(bool default_false)
+{
+    m_enable_deadline_scheduling = default_false;
+    return *this;
+}
+FiberPoolOptions& FiberPoolOptions::enable_scheduler_telemetry(bool default_true)
+{
+    m_enable_scheduler_telemetry = default_true;
+    return *this;
+}
+FiberPoolOptions& FiberPoolOptions::stack_size(std::size_t bytes)
+{
+    m_stack_size = bytes;
+    return *this;
+}
+FiberPoolOptions& FiberPoolOptions::enable_stack_guard_pages(bool default_true)
+{
+    m_enable_stack_guard_pages = default_true;
+    return *this;
+}
+FiberPoolOptions& FiberPoolOptions::stack_pool_capacity(std::size_t count)
+{
+    m_stack_pool_capacity = count;
+    return *this;
+}
 bool FiberPoolOptions::enable_memory_binding() const
 {
     return m_enable_memory_binding;
@@ -46,5 +78,29 @@ bool FiberPoolOptions::enable_tracing_scheduler() const
 {
     return m_enable_tracing_scheduler;
 }
+bool FiberPoolOptions::enable_work_stealing() const
+{
+    return m_enable_work_stealing;
+}
+bool FiberPoolOptions::enable_deadline_scheduling() const
+{
+    return m_enable_deadline_scheduling;
+}
+bool FiberPoolOptions::enable_scheduler_telemetry() const
+{
+    return m_enable_scheduler_telemetry;
+}
+std::size_t FiberPoolOptions::stack_size() const
+{
+    return m_stack_size;
+}
+bool FiberPoolOptions::enable_stack_guard_pages() const
+{
+    return m_enable_stack_guard_pages;
+}
+std::size_t FiberPoolOptions::stack_pool_capacity() const
+{
+    return m_stack_pool_capacity;
+}
 
 }  // namespace srf
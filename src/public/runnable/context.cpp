@@ -22,7 +22,10 @@
 #include <glog/logging.h>
 #include <boost/fiber/fss.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <sstream>
 #include <string>
@@ -47,7 +50,11 @@ struct FiberLocalContext
 
 }  // namespace
 
-Context::Context(std::size_t rank, std::size_t size) : m_rank(rank), m_size(size) {}
+Context::Context(std::size_t rank, std::size_t size) :
+  m_rank(rank),
+  m_size(size),
+  m_collective_state(size > 1 ? collective_bit : 0)
+{}
 
 EngineType Context::execution_context() const
 {
@@ -64,28 +71,43 @@ std::size_t Context::size() const
     return m_size;
 }
 
+// a single instance has no peers to synchronize with until the Runner first grows the collective; a critical section
+// entered before then is not serialized against the instances added while it is held
 void Context::lock()
 {
-    if (m_size > 1)
+    if ((m_collective_state.load(std::memory_order_acquire) & collective_bit) != 0)
     {
         do_lock();
+        m_locked = true;
     }
 }
 
 void Context::unlock()
 {
-    if (m_size > 1)
+    if (m_locked)
     {
+        m_locked = false;
         do_unlock();
     }
 }
 
 void Context::barrier()
 {
-    if (m_size > 1)
+    // count the barriers passed alone, unless the Runner concurrently marks the collective as grown
+    auto state = m_collective_state.load(std::memory_order_acquire);
+    while ((state & collective_bit) == 0)
     {
-        do_barrier();
+        if (m_collective_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel))
+        {
+            return;
+        }
     }
+    do_barrier();
+}
+
+std::uint64_t Context::solo_barriers() const
+{
+    return m_collective_state.load(std::memory_order_acquire) & ~collective_bit;
 }
 
 void Context::yield()
@@ -93,6 +115,35 @@ void Context::yield()
     do_yield();
 }
 
+void Context::consume_yield_budget()
+{
+    if (m_yield_budget_items == 0 && m_yield_budget_time == std::chrono::microseconds::zero())
+    {
+        return;
+    }
+
+    bool exhausted = (m_yield_budget_items != 0 && ++m_items_since_yield >= m_yield_budget_items);
+    if (!exhausted && m_yield_budget_time != std::chrono::microseconds::zero())
+    {
+        exhausted = (std::chrono::steady_clock::now() - m_last_yield >= m_yield_budget_time);
+    }
+
+    if (exhausted)
+    {
+        yield();
+        m_items_since_yield = 0;
+        m_last_yield        = std::chrono::steady_clock::now();
+    }
+}
+
+void Context::set_yield_budget(std::size_t items, std::chrono::microseconds time)
+{
+    m_yield_budget_items = items;
+    m_yield_budget_time  = time;
+    m_items_since_yield  = 0;
+    m_last_yield         = std::chrono::steady_clock::now();
+}
+
 void Context::init(const Runner& runner)
 {
     auto& fiber_local = FiberLocalContext::get();
@@ -140,6 +191,32 @@ Context& Context::get_runtime_context()
     return *fiber_local->m_context;
 }
 
+bool Context::retirable() const
+{
+    return m_retirable;
+}
+
+bool Context::retire_requested() const
+{
+    return m_retire_requested;
+}
+
+void Context::retire()
+{
+    CHECK(m_retire_requested) << info() << ": retire() called on an instance which was not asked to retire";
+    do_retire();
+}
+
+Context* Context::try_get_runtime_context()
+{
+    auto& fiber_local = FiberLocalContext::get();
+    if (fiber_local.get() == nullptr)
+    {
+        return nullptr;
+    }
+    return fiber_local->m_context;
+}
+
 void Context::init_info(std::stringstream& ss)
 {
     ss << "rank: " << rank() << "; size: " << size();
@@ -69,4 +69,9 @@ void Runnable::update_state(State new_state)
 
 void Runnable::on_state_update(const State& /*unused*/) {}
 
+bool Runnable::supports_retirement() const
+{
+    return false;
+}
+
 }  // namespace srf::runnable
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <deque>
 #include <ext/alloc_traits.h>
 #include <functional>
 #include <memory>
@@ -80,10 +81,7 @@ Runner::~Runner()
     if (is_running)
     {
         m_runnable->update_state(Runnable::State::Kill);
-        for (auto& instance : m_instances)
-        {
-            await_join();
-        }
+        await_join();
     }
 }
 
@@ -98,6 +96,8 @@ void Runner::enqueue(std::shared_ptr<Engines> launcher, std::vector<std::shared_
             throw exceptions::SrfRuntimeError("Runner::run() is disabled");
         }
 
+        m_retirable = launcher->launch_options().retirable;
+
         // update to instance count = launcher.count()
         DCHECK_EQ(m_instances.size(), 0);
         m_instances.resize(contexts.size());
@@ -127,35 +127,145 @@ void Runner::enqueue(std::shared_ptr<Engines> launcher, std::vector<std::shared_
 
     for (auto& instance : m_instances)
     {
-        auto context = instance.m_context;
-        auto engine  = instance.m_engine;
-
-        auto f = engine->launch_task([this, context, &instance] {
-            context->init(*this);
-            update_state(context->rank(), State::Running);
-            instance.m_live_promise.set_value();
-            m_runnable->main(*context);
-            if (!context->status())
-            {
-                update_state(context->rank(), State::Error);
-            }
-            update_state(context->rank(), State::Completed);
-            m_status = m_status && context->status();
-            if (--m_remaining_instances == 0)
+        launch(instance, launcher->launch_options());
+    }
+}
+
+void Runner::launch(Instance& instance, const LaunchOptions& launch_options)
+{
+    auto context = instance.m_context;
+    auto engine  = instance.m_engine;
+
+    context->m_retirable = m_retirable;
+
+    const auto yield_budget_items = launch_options.yield_budget_items;
+    const auto yield_budget_time  = launch_options.yield_budget_time;
+
+    auto f = engine->launch_task([this, context, &instance, yield_budget_items, yield_budget_time] {
+        context->init(*this);
+        context->set_yield_budget(yield_budget_items, yield_budget_time);
+        update_state(context->rank(), State::Running);
+        instance.m_live_promise.set_value();
+        m_runnable->main(*context);
+        if (!context->status())
+        {
+            update_state(context->rank(), State::Error);
+        }
+        update_state(context->rank(), State::Completed);
+        m_status = m_status && context->status();
+        if (--m_remaining_instances == 0)
+        {
+            if (m_completion_callback)
             {
-                if (m_completion_callback)
-                {
-                    m_completion_callback(m_status);
-                }
+                m_completion_callback(m_status);
             }
-            context->finish();
-        });
+        }
+        context->finish();
+    });
+
+    instance.m_join_future = f.share();
+}
 
-        instance.m_join_future = f.share();
+void Runner::add_engines(std::shared_ptr<Engines> engines)
+{
+    CHECK(engines && engines->size());
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+
+    auto active = get_active_instances();
+    if (not m_can_run || active.empty() || m_runnable->m_state != Runnable::State::Run)
+    {
+        throw exceptions::SrfRuntimeError("Runner::add_engines requires a running Runnable");
+    }
+
+    // new peers are constructed from, and enrolled in the collective of, an active context; marking the collective as
+    // grown freezes the count of barriers a single instance passed alone
+    auto& peer_of = *active.front()->m_context;
+    auto size     = active.size() + engines->size();
+    for (auto* instance : active)
+    {
+        instance->m_context->m_size = size;
+        instance->m_context->m_collective_state.fetch_or(Context::collective_bit);
+    }
+
+    // count the new instances before any of them can complete
+    m_remaining_instances += engines->size();
+
+    for (const auto& engine : engines->launchers())
+    {
+        auto rank      = m_instances.size();
+        auto& instance = m_instances.emplace_back();
+
+        instance.m_uid         = rank;
+        instance.m_live_future = instance.m_live_promise.get_future().share();
+        instance.m_context     = peer_of.do_make_peer(rank, size);
+        instance.m_engine      = engine;
+
+        instance.m_context->m_collective_state = peer_of.m_collective_state.load();
+        update_state(rank, State::Queued);
+
+        DVLOG(10) << "Runner::add_engines - launching instance with rank " << rank << "; size " << size;
+        launch(instance, engines->launch_options());
     }
 }
 
-const std::vector<Runner::Instance>& Runner::instances() const
+void Runner::retire_engines(std::size_t count)
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+
+    if (!m_runnable->supports_retirement())
+    {
+        throw exceptions::SrfRuntimeError("Runner::retire_engines - the Runnable does not support retirement");
+    }
+
+    if (!m_retirable)
+    {
+        throw exceptions::SrfRuntimeError("Runner::retire_engines requires a Runnable launched with "
+                                          "LaunchOptions::retirable");
+    }
+
+    auto active = get_active_instances();
+    if (count >= active.size())
+    {
+        throw exceptions::SrfRuntimeError("Runner::retire_engines must leave at least one active instance");
+    }
+
+    // retire the most recently launched instances; the instance with rank 0 is retired last
+    auto size = active.size() - count;
+    for (std::size_t i = 0; i < active.size(); ++i)
+    {
+        auto& context = *active[i]->m_context;
+        if (i < size)
+        {
+            context.m_size = size;
+        }
+        else
+        {
+            DVLOG(10) << "Runner::retire_engines - retiring instance with rank " << context.rank();
+            context.m_retire_requested = true;
+        }
+    }
+}
+
+std::size_t Runner::active_instances() const
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    return get_active_instances().size();
+}
+
+std::vector<Runner::Instance*> Runner::get_active_instances() const
+{
+    std::vector<Instance*> active;
+    for (auto& instance : m_instances)
+    {
+        if (instance.m_state < State::Error && !instance.m_context->retire_requested())
+        {
+            active.push_back(&instance);
+        }
+    }
+    return active;
+}
+
+const std::deque<Runner::Instance>& Runner::instances() const
 {
     return m_instances;
 }
@@ -171,11 +281,22 @@ void Runner::await_live() const
 void Runner::await_join() const
 {
     std::exception_ptr first_exception{nullptr};
-    for (const auto& instance : instances())
+
+    // instances may be added while awaiting; index under the lock rather than iterating
+    for (std::size_t i = 0;; ++i)
     {
+        SharedFuture<void> join_future;
+        {
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            if (i >= m_instances.size())
+            {
+                break;
+            }
+            join_future = m_instances[i].join_future();
+        }
         try
         {
-            instance.join_future().get();
+            join_future.get();
         } catch (...)
         {
             if (first_exception == nullptr)
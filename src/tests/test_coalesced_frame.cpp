@@ -0,0 +1,115 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/data_plane/coalesced_frame.hpp"
+
+#include <srf/exceptions/runtime_error.hpp>
+#include <srf/types.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace srf;
+using namespace srf::internal::data_plane;
+
+class TestCoalescedFrame : public ::testing::Test
+{
+  protected:
+    static std::vector<std::uint8_t> make_frame(const std::vector<std::pair<PortAddress, std::string>>& records)
+    {
+        std::vector<std::uint8_t> frame;
+        for (const auto& [address, payload] : records)
+        {
+            auto* dst = coalesced::append_record(frame, address, payload.size());
+            std::memcpy(dst, payload.data(), payload.size());
+        }
+        return frame;
+    }
+
+    static std::vector<std::pair<PortAddress, std::string>> read_frame(const std::vector<std::uint8_t>& frame)
+    {
+        std::vector<std::pair<PortAddress, std::string>> records;
+        auto on_record = [&](PortAddress address, const void* data, std::size_t bytes) {
+            records.emplace_back(address, std::string(static_cast<const char*>(data), bytes));
+        };
+        coalesced::for_each_record(frame.data(), frame.size(), on_record);
+        return records;
+    }
+};
+
+TEST_F(TestCoalescedFrame, RoundTrip)
+{
+    std::vector<std::pair<PortAddress, std::string>> records = {
+        {0x0001000200030004, "first"}, {42, ""}, {0xffffffffffffffff, std::string(1000, 'x')}, {7, "last"}};
+
+    auto frame = make_frame(records);
+
+    std::size_t expected_bytes = 0;
+    for (const auto& [address, payload] : records)
+    {
+        expected_bytes += coalesced::record_bytes(payload.size());
+    }
+    EXPECT_EQ(frame.size(), expected_bytes);
+    EXPECT_EQ(read_frame(frame), records);
+}
+
+TEST_F(TestCoalescedFrame, EmptyFrame)
+{
+    EXPECT_TRUE(read_frame({}).empty());
+}
+
+TEST_F(TestCoalescedFrame, HeaderIsLittleEndian)
+{
+    auto frame = make_frame({{0x0102030405060708, "abc"}});
+
+    ASSERT_EQ(frame.size(), coalesced::record_bytes(3));
+    std::vector<std::uint8_t> header(frame.begin(), frame.begin() + coalesced::record_header_bytes);
+    std::vector<std::uint8_t> expected = {0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x03, 0x00, 0x00, 0x00};
+    EXPECT_EQ(header, expected);
+}
+
+TEST_F(TestCoalescedFrame, TruncatedHeader)
+{
+    auto frame = make_frame({{1, "payload"}, {2, "payload"}});
+
+    // cut into the header of the second record
+    frame.resize(coalesced::record_bytes(7) + coalesced::record_header_bytes - 1);
+    EXPECT_THROW(read_frame(frame), exceptions::SrfRuntimeError);
+
+    // a frame shorter than a single header
+    frame.resize(coalesced::record_header_bytes - 1);
+    EXPECT_THROW(read_frame(frame), exceptions::SrfRuntimeError);
+}
+
+TEST_F(TestCoalescedFrame, TruncatedPayload)
+{
+    auto frame = make_frame({{1, "payload"}, {2, "payload"}});
+
+    // cut into the payload of the second record
+    frame.pop_back();
+    EXPECT_THROW(read_frame(frame), exceptions::SrfRuntimeError);
+
+    // header only; no payload bytes
+    frame.resize(coalesced::record_header_bytes);
+    EXPECT_THROW(read_frame(frame), exceptions::SrfRuntimeError);
+}
@@ -0,0 +1,206 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/system/fiber_idle_waiter.hpp"
+#include "internal/system/fiber_priority_scheduler.hpp"
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
+#include "internal/ucx/event_waker.hpp"
+
+#include <gtest/gtest.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <boost/fiber/fiber.hpp>
+#include <boost/fiber/future/future.hpp>
+#include <boost/fiber/future/promise.hpp>
+#include <boost/fiber/operations.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace srf;
+using namespace srf::internal;
+
+namespace {
+
+// std::this_thread::get_id may be folded across a fiber switch, since the compiler assumes it is constant within a
+// function; a migrated fiber must observe the id of the thread it resumed on
+long current_thread_id()
+{
+    return syscall(SYS_gettid);
+}
+
+}  // namespace
+
+class TestEventWaker : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        m_fd = eventfd(0, EFD_NONBLOCK);
+        ASSERT_GE(m_fd, 0);
+    }
+
+    void TearDown() override
+    {
+        close(m_fd);
+    }
+
+    void write_event() const
+    {
+        std::uint64_t value = 1;
+        EXPECT_EQ(write(m_fd, &value, sizeof(value)), sizeof(value));
+    }
+
+    void consume_event() const
+    {
+        std::uint64_t value;
+        EXPECT_EQ(read(m_fd, &value, sizeof(value)), sizeof(value));
+    }
+
+    // exercises an EventWaker from a fiber on the calling thread
+    void run_waker_checks() const
+    {
+        ucx::EventWaker waker(m_fd);
+        EXPECT_FALSE(waker.await_event(std::chrono::milliseconds(1)));
+
+        // a notification issued before the wait is not lost
+        waker.notify();
+        EXPECT_TRUE(waker.await_event(std::chrono::seconds(5)));
+        EXPECT_FALSE(waker.await_event(std::chrono::milliseconds(1)));
+
+        // a notification from another thread wakes a suspended waiter
+        std::thread notifier([&waker] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            waker.notify();
+        });
+        EXPECT_TRUE(waker.await_event(std::chrono::seconds(5)));
+        notifier.join();
+
+        // the descriptor becoming readable wakes a suspended waiter; the event is level-triggered until consumed
+        std::thread writer([this] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            write_event();
+        });
+        EXPECT_TRUE(waker.await_event(std::chrono::seconds(5)));
+        writer.join();
+        consume_event();
+        EXPECT_FALSE(waker.await_event(std::chrono::milliseconds(1)));
+    }
+
+    int m_fd{-1};
+};
+
+TEST_F(TestEventWaker, PollingFallback)
+{
+    // the default boost scheduler has no idle waiter to watch the descriptor
+    ASSERT_EQ(system::FiberIdleWaiter::current(), nullptr);
+    run_waker_checks();
+}
+
+TEST_F(TestEventWaker, FiberScheduler)
+{
+    std::thread thread([this] {
+        boost::fibers::use_scheduling_algorithm<system::FiberPriorityScheduler>();
+        ASSERT_NE(system::FiberIdleWaiter::current(), nullptr);
+
+        run_waker_checks();
+
+        // other fibers on the thread keep running while a fiber waits on the descriptor
+        std::atomic<bool> waiting{true};
+        std::size_t yields = 0;
+        boost::fibers::fiber worker([&] {
+            while (waiting)
+            {
+                ++yields;
+                boost::this_fiber::yield();
+            }
+        });
+
+        ucx::EventWaker waker(m_fd);
+        EXPECT_FALSE(waker.await_event(std::chrono::milliseconds(5)));
+        waiting = false;
+        worker.join();
+        EXPECT_GT(yields, 0);
+    });
+    thread.join();
+
+    EXPECT_EQ(system::FiberIdleWaiter::current(), nullptr);
+}
+
+TEST_F(TestEventWaker, WorkStealingScheduler)
+{
+    system::FiberWorkStealingGroup group({0, 0});
+    boost::fibers::promise<void> done;
+    auto done_future = done.get_future().share();
+
+    std::atomic<std::size_t> migrated_waits{0};
+
+    // the owner thread stays busy with pinned yielding fibers while the peer idles, so whenever the waiter becomes
+    // ready the peer is woken to steal it; a waiter which did not pin itself would be resumed on the peer and unwatch
+    // its descriptor from the wrong thread
+    std::thread owner([&] {
+        boost::fibers::use_scheduling_algorithm<system::FiberWorkStealingScheduler>(group, 0);
+        std::atomic<bool> waiting{true};
+
+        std::vector<boost::fibers::fiber> yielders;
+        for (int i = 0; i < 4; ++i)
+        {
+            yielders.emplace_back(boost::fibers::launch::dispatch, [&] {
+                boost::this_fiber::properties<system::FiberPriorityProps>().set_pinned(true);
+                while (waiting)
+                {
+                    boost::this_fiber::yield();
+                }
+            });
+        }
+
+        boost::fibers::fiber waiter(boost::fibers::launch::dispatch, [&] {
+            ucx::EventWaker waker(m_fd);
+            for (int i = 0; i < 200; ++i)
+            {
+                auto thread_id = current_thread_id();
+                waker.await_event(std::chrono::microseconds(100));
+                if (current_thread_id() != thread_id)
+                {
+                    ++migrated_waits;
+                }
+            }
+        });
+
+        waiter.join();
+        waiting = false;
+        for (auto& yielder : yielders)
+        {
+            yielder.join();
+        }
+        done.set_value();
+    });
+
+    std::thread peer([&] {
+        boost::fibers::use_scheduling_algorithm<system::FiberWorkStealingScheduler>(group, 1);
+        done_future.wait();
+    });
+
+    owner.join();
+    peer.join();
+
+    EXPECT_EQ(migrated_waits, 0);
+}
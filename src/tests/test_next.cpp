@@ -412,6 +412,183 @@ TEST_F(TestNext, ConcurrentSinkRxRunnable)
     EXPECT_EQ(counter_1, 4);
 }
 
+TEST_F(TestNext, SinkYieldBudget)
+{
+    using input_t  = double;
+    using output_t = float;
+
+    auto source = std::make_unique<ExampleSourceChannel<input_t>>();
+    auto sink   = std::make_unique<node::RxSink<output_t>>();
+
+    node::make_edge(*source, *sink);
+
+    for (int i = 0; i < 8; i++)
+    {
+        source->ingress().await_write(3.14);
+    }
+    source.reset();
+
+    std::atomic<std::size_t> counter_0 = 0;
+    std::atomic<std::size_t> counter_1 = 0;
+
+    // neither instance blocks on the channel, so without a budget the first instance to run may drain every item
+    sink->set_observer([&counter_0, &counter_1](output_t output) {
+        const auto& ctx = runnable::Context::get_runtime_context();
+        if (ctx.rank())  // NOLINT
+        {
+            ++counter_1;
+        }
+        else
+        {
+            ++counter_0;
+        }
+    });
+
+    // both instances share a single fiber task queue
+    runnable::LaunchOptions options;
+    options.pe_count           = 1;
+    options.engines_per_pe     = 2;
+    options.yield_budget_items = 1;
+
+    auto runner =
+        m_resources->partition(0).host().launch_control().prepare_launcher(options, std::move(sink))->ignition();
+    runner->await_join();
+
+    EXPECT_EQ(counter_0 + counter_1, 8);
+    EXPECT_GT(counter_0, 0);
+    EXPECT_GT(counter_1, 0);
+}
+
+TEST_F(TestNext, SinkAddAndRetireEngines)
+{
+    using input_t  = double;
+    using output_t = float;
+
+    auto source = std::make_unique<ExampleSourceChannel<input_t>>();
+    auto sink   = std::make_unique<node::RxSink<output_t>>();
+
+    node::make_edge(*source, *sink);
+
+    std::atomic<std::size_t> counter = 0;
+    sink->set_observer([&counter](output_t output) { ++counter; });
+
+    auto& launch_control = m_resources->partition(0).host().launch_control();
+
+    runnable::LaunchOptions options;
+    options.retirable = true;
+    auto runner       = launch_control.prepare_launcher(options, std::move(sink))->ignition();
+    runner->await_live();
+    EXPECT_EQ(runner->active_instances(), 1);
+    EXPECT_ANY_THROW(runner->retire_engines(1));
+
+    source->ingress().await_write(1.0);
+
+    options.pe_count = 2;
+    runner->add_engines(launch_control.build_engines(options));
+    EXPECT_EQ(runner->active_instances(), 3);
+    EXPECT_EQ(runner->instances().size(), 3);
+
+    source->ingress().await_write(2.0);
+
+    runner->retire_engines(2);
+    EXPECT_EQ(runner->active_instances(), 1);
+
+    // retired instances exit after the item in hand, if any, or once they observe the request while idle
+    for (int i = 0; i < 8; i++)
+    {
+        source->ingress().await_write(3.0);
+    }
+    source.reset();
+
+    runner->await_join();
+    EXPECT_EQ(counter, 10);
+}
+
+TEST_F(TestNext, SinkRetireWhileIdle)
+{
+    auto source = std::make_unique<ExampleSourceChannel<int>>();
+    auto sink   = std::make_unique<node::RxSink<int>>();
+
+    node::make_edge(*source, *sink);
+
+    std::atomic<std::size_t> counter = 0;
+    sink->set_observer([&counter](int data) { ++counter; });
+
+    auto& launch_control = m_resources->partition(0).host().launch_control();
+
+    runnable::LaunchOptions options;
+    options.pe_count  = 2;
+    options.retirable = true;
+    auto runner       = launch_control.prepare_launcher(options, std::move(sink))->ignition();
+    runner->await_live();
+    EXPECT_EQ(runner->active_instances(), 2);
+
+    // no data is ever written before the retired instance completes
+    runner->retire_engines(1);
+    EXPECT_EQ(runner->active_instances(), 1);
+    runner->instances().at(1).join_future().get();
+    EXPECT_EQ(counter, 0);
+
+    source->ingress().await_write(1);
+    source.reset();
+
+    runner->await_join();
+    EXPECT_EQ(counter, 1);
+}
+
+TEST_F(TestNext, SinkRetirementRequiresRetirable)
+{
+    auto source = std::make_unique<ExampleSourceChannel<int>>();
+    auto sink   = std::make_unique<node::RxSink<int>>();
+
+    node::make_edge(*source, *sink);
+
+    auto& launch_control = m_resources->partition(0).host().launch_control();
+
+    // instances launched without LaunchOptions::retirable block on their channel and can not observe retirement
+    runnable::LaunchOptions options;
+    options.pe_count = 2;
+    auto runner      = launch_control.prepare_launcher(options, std::move(sink))->ignition();
+    runner->await_live();
+
+    EXPECT_ANY_THROW(runner->retire_engines(1));
+    EXPECT_EQ(runner->active_instances(), 2);
+
+    source.reset();
+    runner->await_join();
+}
+
+TEST_F(TestNext, SourceRetirementRejected)
+{
+    std::atomic<bool> done{false};
+    auto source = std::make_unique<node::RxSource<int>>(
+        rxcpp::observable<>::create<int>([&done](rxcpp::subscriber<int> s) {
+            while (!done)
+            {
+                boost::this_fiber::sleep_for(std::chrono::milliseconds(1));
+            }
+            s.on_completed();
+        }));
+    auto sink = std::make_unique<node::RxSink<int>>();
+    node::make_edge(*source, *sink);
+
+    auto& launch_control = m_resources->partition(0).host().launch_control();
+
+    runnable::LaunchOptions options;
+    options.pe_count   = 2;
+    auto source_runner = launch_control.prepare_launcher(options, std::move(source))->ignition();
+    auto sink_runner   = launch_control.prepare_launcher(std::move(sink))->ignition();
+    source_runner->await_live();
+
+    // sources only stop when their data is exhausted, so they can not honor retirement
+    EXPECT_ANY_THROW(source_runner->retire_engines(1));
+    EXPECT_EQ(source_runner->active_instances(), 2);
+
+    done = true;
+    source_runner->await_join();
+    sink_runner->await_join();
+}
+
 TEST_F(TestNext, SourceNodeSink)
 {
     using input_t  = double;
@@ -17,10 +17,12 @@
 
 #include "pipelines/common_pipelines.hpp"
 
+#include "internal/pipeline/autoscaler.hpp"
 #include "internal/pipeline/manager.hpp"
 #include "internal/pipeline/pipeline.hpp"
 #include "internal/pipeline/types.hpp"
 #include "internal/resources/resource_partitions.hpp"
+#include "internal/segment/definition.hpp"
 #include "internal/system/system.hpp"
 #include "internal/utils/collision_detector.hpp"
 
@@ -29,6 +31,7 @@
 #include "srf/channel/status.hpp"
 #include "srf/core/addresses.hpp"
 #include "srf/core/executor.hpp"
+#include "srf/exceptions/runtime_error.hpp"
 #include "srf/internal/pipeline/ipipeline.hpp"
 #include "srf/internal/segment/idefinition.hpp"
 #include "srf/node/rx_sink.hpp"
@@ -38,6 +41,7 @@
 #include "srf/options/options.hpp"
 #include "srf/options/topology.hpp"
 #include "srf/pipeline/pipeline.hpp"
+#include "srf/protos/architect.pb.h"
 #include "srf/runnable/context.hpp"
 #include "srf/segment/builder.hpp"
 #include "srf/segment/egress_ports.hpp"
@@ -56,7 +60,9 @@
 #include <boost/fiber/fiber.hpp>
 #include <boost/fiber/operations.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <map>
@@ -66,6 +72,7 @@
 #include <string>
 #include <system_error>
 #include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -232,6 +239,46 @@ TEST_F(TestPipeline, MultiSegment)
     executor.join();
 }
 
+TEST_F(TestPipeline, SegmentPortHop)
+{
+    // segment ports are pass-through muxers; every element must cross the egress -> ingress -> egress -> ingress hops
+    // and the pipeline must shut down once the source completes
+    const int count = 1000;
+    std::atomic<int> counter{0};
+
+    auto pipeline = srf::make_pipeline();
+
+    pipeline->make_segment("seg_1", segment::EgressPorts<int>({"a"}), [count](segment::Builder& s) {
+        auto src    = s.make_object("src", test::nodes::finite_int_rx_source(count));
+        auto egress = s.get_egress<int>("a");
+        s.make_edge(src, egress);
+    });
+
+    pipeline->make_segment(
+        "seg_2", segment::IngressPorts<int>({"a"}), segment::EgressPorts<int>({"b"}), [](segment::Builder& s) {
+            auto ingress = s.get_ingress<int>("a");
+            auto egress  = s.get_egress<int>("b");
+            s.make_edge(ingress, egress);
+        });
+
+    pipeline->make_segment("seg_3", segment::IngressPorts<int>({"b"}), [&counter](segment::Builder& s) {
+        auto ingress = s.get_ingress<int>("b");
+        auto sink    = s.make_sink<int>("sink", [&counter](int x) { ++counter; });
+        s.make_edge(ingress, sink);
+    });
+
+    auto options = std::make_shared<Options>();
+    options->topology().user_cpuset("0");
+    options->topology().restrict_gpus(true);
+
+    Executor executor(options);
+    executor.register_pipeline(std::move(pipeline));
+    executor.start();
+    executor.join();
+
+    EXPECT_EQ(counter, count);
+}
+
 TEST_F(TestPipeline, MultiSegmentLoadBalancer)
 {
     // the default connection/manifold type between segments is a load balancer
@@ -279,3 +326,169 @@ TEST_F(TestPipeline, MultiSegmentLoadBalancer)
     EXPECT_EQ(ranks.size(), count);
     EXPECT_EQ(count_by_rank.size(), 2);
 }
+
+TEST_F(TestPipeline, DynamicScalingPolicy)
+{
+    protos::ScalingOptions options;
+    options.set_strategy(protos::ScalingOptions::Dynamic);
+    options.set_initial_count(1);
+    options.set_min_count(1);
+    options.set_max_count(3);
+    options.set_scale_up_pressure(0.25);
+    options.set_scale_down_utilization(0.5);
+    options.set_scale_down_periods(2);
+
+    internal::pipeline::ScalingPolicy policy(options);
+    EXPECT_EQ(policy.initial_count(), 1);
+
+    // saturated inputs add instances up to max_count; capacity is learned at 100 objects/s per instance
+    EXPECT_EQ(policy.evaluate({1, 0.9, 100.0}), 2);
+    EXPECT_EQ(policy.evaluate({2, 0.9, 200.0}), 3);
+    EXPECT_EQ(policy.evaluate({3, 0.9, 300.0}), 3);
+
+    // the rate could be served by 2 instances, but not at 50% utilization
+    EXPECT_EQ(policy.evaluate({3, 0.0, 150.0}), 3);
+    EXPECT_EQ(policy.evaluate({3, 0.0, 150.0}), 3);
+
+    // underutilized instances are removed only after scale_down_periods consecutive evaluations
+    EXPECT_EQ(policy.evaluate({3, 0.0, 50.0}), 3);
+    EXPECT_EQ(policy.evaluate({3, 0.0, 50.0}), 2);
+    EXPECT_EQ(policy.evaluate({2, 0.0, 10.0}), 2);
+    EXPECT_EQ(policy.evaluate({2, 0.0, 10.0}), 1);
+
+    // never below min_count
+    EXPECT_EQ(policy.evaluate({1, 0.0, 0.0}), 1);
+    EXPECT_EQ(policy.evaluate({1, 0.0, 0.0}), 1);
+}
+
+TEST_F(TestPipeline, DynamicScalingRequiresMaxCount)
+{
+    auto pipeline = srf::make_pipeline();
+    auto segdef   = pipeline->make_segment("seg_1", segment::IngressPorts<int>({"i"}), [](segment::Builder& s) {});
+
+    // proto3 leaves an unset max_count at 0
+    protos::SegmentOptions options;
+    options.mutable_scaling_options()->set_strategy(protos::ScalingOptions::Dynamic);
+    options.mutable_scaling_options()->set_min_count(1);
+    EXPECT_THROW(segdef->set_options(options), exceptions::SrfRuntimeError);
+
+    options.mutable_scaling_options()->set_max_count(2);
+    EXPECT_NO_THROW(segdef->set_options(options));
+}
+
+TEST_F(TestPipeline, EgressEagerThresholds)
+{
+    auto pipeline = srf::make_pipeline();
+    auto segdef =
+        pipeline->make_segment("seg_1", segment::EgressPorts<int, int>({"small", "large"}), [](segment::Builder& s) {});
+
+    protos::SegmentOptions options;
+    (*options.mutable_egress_eager_thresholds())["missing"] = 1024;
+    EXPECT_THROW(segdef->set_options(options), exceptions::SrfRuntimeError);
+
+    options.mutable_egress_eager_thresholds()->clear();
+    (*options.mutable_egress_eager_thresholds())["small"] = 1024;
+    EXPECT_NO_THROW(segdef->set_options(options));
+
+    // the segment builder applies these options to the egress ports it constructs
+    auto definition = unwrap(*pipeline)->find_segment(segment_name_hash("seg_1"));
+    EXPECT_EQ(definition->egress_encoding_options("small").eager_threshold(), 1024);
+    EXPECT_EQ(definition->egress_encoding_options("large").eager_threshold(), codable::default_eager_threshold());
+}
+
+TEST_F(TestPipeline, DynamicScalingEndToEnd)
+{
+    // seg_1 floods a deliberately slow seg_2 until seg_2 has been scaled up to max_count, then goes quiet until the
+    // autoscaler has retired every instance above min_count; retired instances complete once their manifold output
+    // has been dropped
+
+    auto pipeline = srf::make_pipeline();
+
+    std::atomic<bool> flood{true};
+    std::atomic<bool> done{false};
+    std::atomic<int> completed_instances{0};
+
+    pipeline->make_segment("seg_1", segment::EgressPorts<int>({"i"}), [&](segment::Builder& s) {
+        auto src    = s.make_source<int>("src", [&](rxcpp::subscriber<int> sub) {
+            int i = 0;
+            while (sub.is_subscribed() && !done)
+            {
+                if (flood)
+                {
+                    sub.on_next(i++);
+                }
+                else
+                {
+                    boost::this_fiber::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            sub.on_completed();
+        });
+        auto egress = s.get_egress<int>("i");
+        s.make_edge(src, egress);
+    });
+
+    auto seg_2 = pipeline->make_segment("seg_2", segment::IngressPorts<int>({"i"}), [&](segment::Builder& s) {
+        auto sink    = s.make_sink<int>(
+            "sink",
+            [](int /*x*/) { boost::this_fiber::sleep_for(std::chrono::microseconds(200)); },
+            [&] { ++completed_instances; });
+        auto ingress = s.get_ingress<int>("i");
+        s.make_edge(ingress, sink);
+    });
+
+    protos::SegmentOptions options;
+    auto* scaling = options.mutable_scaling_options();
+    scaling->set_strategy(protos::ScalingOptions::Dynamic);
+    scaling->set_initial_count(1);
+    scaling->set_min_count(1);
+    scaling->set_max_count(3);
+    scaling->set_evaluation_period_ms(20);
+    scaling->set_scale_up_pressure(0.1);
+    scaling->set_scale_down_periods(2);
+    seg_2->set_options(options);
+
+    auto resources = internal::resources::make_resource_partitions(make_system([](Options& options) {
+        options.topology().user_cpuset("0-1");
+        options.topology().restrict_gpus(true);
+    }));
+
+    auto manager = std::make_unique<internal::pipeline::Manager>(unwrap(*pipeline), resources);
+
+    auto seg_2_count = [&manager] {
+        std::size_t count = 0;
+        for (const auto& [address, partition] : manager->current_assignments())
+        {
+            count += (std::get<0>(segment_address_decode(address)) == segment_name_hash("seg_2") ? 1 : 0);
+        }
+        return count;
+    };
+
+    auto wait_for = [](auto predicate) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return predicate();
+    };
+
+    internal::pipeline::SegmentAddresses update;
+    update[segment_address_encode(segment_name_hash("seg_1"), 0)] = 0;
+    update[segment_address_encode(segment_name_hash("seg_2"), 0)] = 0;
+
+    manager->service_start();
+    manager->push_updates(std::move(update));
+
+    // scale up through Manager::push_updates
+    EXPECT_TRUE(wait_for([&] { return seg_2_count() == 3; }));
+
+    // scale down; each retired instance drains and completes after its manifold output is dropped
+    flood = false;
+    EXPECT_TRUE(wait_for([&] { return seg_2_count() == 1; }));
+    EXPECT_TRUE(wait_for([&] { return completed_instances == 2; }));
+
+    done = true;
+    manager->service_await_join();
+    EXPECT_EQ(completed_instances, 3);
+}
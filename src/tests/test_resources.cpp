@@ -16,20 +16,35 @@
  */
 
 #include "internal/pipeline/types.hpp"
+#include "internal/resources/host_resources.hpp"
+#include "internal/resources/partition_resources.hpp"
 #include "internal/resources/resource_partitions.hpp"
 #include "internal/resources/system_resources.hpp"
 #include "internal/system/system.hpp"
 #include "srf/channel/forward.hpp"
+#include "srf/codable/memory_resources.hpp"
+#include "srf/core/bitmap.hpp"
+#include "srf/memory/adaptors.hpp"
+#include "srf/memory/buffer.hpp"
+#include "srf/memory/literals.hpp"
+#include "srf/memory/resource_view.hpp"
+#include "srf/memory/resources/arena_resource.hpp"
+#include "srf/memory/resources/host/numa_memory_resource.hpp"
 #include "srf/options/options.hpp"
+#include "srf/options/topology.hpp"
+#include "srf/utils/thread_local_shared_pointer.hpp"
 
 #include <gtest/gtest.h>
+#include <hwloc.h>
 
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <utility>
 
 using namespace srf;
 using namespace internal;
+using namespace memory::literals;
 
 // iwyu is getting confused between std::uint32_t and boost::uint32_t
 // IWYU pragma: no_include <boost/cstdint.hpp>
@@ -58,3 +73,60 @@ TEST_F(TestResources, LifeCycleResourcePartitions)
 {
     auto resource_partitions = resources::make_resource_partitions(make_system());
 }
+
+TEST_F(TestResources, NumaMemoryResource)
+{
+    hwloc_topology_t topology;
+    ASSERT_EQ(hwloc_topology_init(&topology), 0);
+    ASSERT_EQ(hwloc_topology_load(topology), 0);
+
+    NumaSet numa_set;
+    numa_set.on(hwloc_get_obj_by_type(topology, HWLOC_OBJ_NUMANODE, 0)->os_index);
+
+    {
+        auto numa = std::make_shared<memory::numa_memory_resource>(topology, numa_set);
+        memory::resource_view<::cuda::memory_access::host> view(numa);
+        EXPECT_EQ(view.kind(), memory::memory_kind_type::host);
+
+        auto mb = memory::buffer<::cuda::memory_access::host>(1_MiB, numa);
+        EXPECT_NE(mb.data(), nullptr);
+        std::memset(mb.data(), 0xff, 1_MiB);
+
+        EXPECT_EQ(numa->allocate(0), nullptr);
+
+        // small allocations are sub-allocated from NUMA-bound superblocks
+        auto arena = memory::make_shared_resource<memory::arena_resource>(numa, 4_MiB, 16_MiB);
+        auto* ptr  = arena->allocate(256);
+        EXPECT_NE(ptr, nullptr);
+        std::memset(ptr, 0xff, 256);
+        arena->deallocate(ptr, 256);
+    }
+
+    hwloc_topology_destroy(topology);
+}
+
+TEST_F(TestResources, PartitionHostMemoryResource)
+{
+    auto resource_partitions = resources::make_resource_partitions(make_system([](Options& options) {
+        options.topology().user_cpuset("0");
+        options.topology().restrict_gpus(true);
+    }));
+
+    auto& host = resource_partitions->partition(0).host();
+    ASSERT_NE(host.memory_resource(), nullptr);
+
+    // the partition's arena is the host view of the thread local codable memory resources on its threads
+    host.main()
+        .enqueue([&host] {
+            auto registered = std::dynamic_pointer_cast<resources::PartitionMemoryResources>(
+                utils::ThreadLocalSharedPointer<codable::MemoryResources>::get());
+            ASSERT_NE(registered, nullptr);
+            EXPECT_EQ(registered->host_resource(), host.memory_resource());
+
+            auto view = registered->host_resource_view();
+            auto* ptr = view.allocate(1_KiB);
+            EXPECT_NE(ptr, nullptr);
+            view.deallocate(ptr, 1_KiB);
+        })
+        .get();
+}
@@ -21,6 +21,10 @@
 #include "internal/system/forward.hpp"
 #include "internal/system/system.hpp"
 
+#include "srf/node/edge_builder.hpp"
+#include "srf/node/operators/muxer.hpp"
+#include "srf/node/rx_sink.hpp"
+#include "srf/node/rx_source.hpp"
 #include "srf/options/engine_groups.hpp"
 #include "srf/options/options.hpp"
 #include "srf/runnable/launch_options.hpp"
@@ -37,6 +41,7 @@
 
 #include <glog/logging.h>
 #include <gtest/gtest.h>
+#include <rxcpp/rx.hpp>
 #include <boost/fiber/operations.hpp>
 
 #include <atomic>
@@ -135,6 +140,33 @@ class TestThreadRunnable final : public runnable::ThreadRunnable<>
     }
 };
 
+class TestBarrierRunnable final : public runnable::FiberRunnable<>
+{
+  public:
+    TestBarrierRunnable(std::atomic<bool>& grown, std::atomic<std::size_t>& passed) : m_grown(grown), m_passed(passed)
+    {}
+
+  private:
+    void run(ContextType& ctx) final
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            // the first instance passes half of its barriers alone, then waits for a peer to be added
+            while (i == 5 && ctx.rank() == 0 && !m_grown)
+            {
+                boost::this_fiber::sleep_for(std::chrono::milliseconds(1));
+            }
+            ctx.lock();
+            ctx.unlock();
+            ctx.barrier();
+            ++m_passed;
+        }
+    }
+
+    std::atomic<bool>& m_grown;
+    std::atomic<std::size_t>& m_passed;
+};
+
 TEST_F(TestRunnable, TypeTraitsGeneric)
 {
     using ctx_t = runnable::runnable_context_t<TestGenericRunnable>;
@@ -267,6 +299,74 @@ TEST_F(TestRunnable, RunnerOutOfScope)
     runner->await_live();
 }
 
+TEST_F(TestRunnable, BarrierAfterAddEngines)
+{
+    std::atomic<bool> grown{false};
+    std::atomic<std::size_t> passed{0};
+
+    runnable::LaunchOptions factory;
+    factory.engine_factory_name = "default";
+
+    auto& launch_control = m_resources->partition(0).host().launch_control();
+    auto runner =
+        launch_control.prepare_launcher(factory, std::make_unique<TestBarrierRunnable>(grown, passed))->ignition();
+
+    runner->await_live();
+    while (passed < 5)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // the new instance skips the barriers the first instance passed alone and meets it at the remaining five
+    runner->add_engines(launch_control.build_engines(factory));
+    grown = true;
+    runner->await_join();
+
+    EXPECT_EQ(passed, 20);
+}
+
+TEST_F(TestRunnable, OperatorMuxerMultipleSources)
+{
+    std::atomic<std::size_t> counter = 0;
+    std::unique_ptr<runnable::Runner> runner_source_1;
+    std::unique_ptr<runnable::Runner> runner_source_2;
+    std::unique_ptr<runnable::Runner> runner_sink;
+
+    auto& launch_control = m_resources->partition(0).host().launch_control();
+
+    // the muxer must only release its downstream channel after every upstream source has completed
+    {
+        auto make_source = [] {
+            return std::make_unique<node::RxSource<float>>(
+                rxcpp::observable<>::create<float>([](rxcpp::subscriber<float> s) {
+                    s.on_next(1.0f);
+                    s.on_next(2.0f);
+                    s.on_next(3.0f);
+                    s.on_completed();
+                }));
+        };
+        auto source_1 = make_source();
+        auto source_2 = make_source();
+        auto muxer    = std::make_shared<node::Muxer<float>>();
+        auto sink =
+            std::make_unique<node::RxSink<float>>(rxcpp::make_observer_dynamic<float>([&](float x) { ++counter; }));
+
+        node::make_edge(*source_1, *muxer);
+        node::make_edge(*source_2, *muxer);
+        node::make_edge(*muxer, *sink);
+
+        runner_sink     = launch_control.prepare_launcher(std::move(sink))->ignition();
+        runner_source_1 = launch_control.prepare_launcher(std::move(source_1))->ignition();
+        runner_source_2 = launch_control.prepare_launcher(std::move(source_2))->ignition();
+    }
+
+    runner_source_1->await_join();
+    runner_source_2->await_join();
+    runner_sink->await_join();
+
+    EXPECT_EQ(counter, 6);
+}
+
 // Move the remaining tests to TestNode
 
 // TEST_F(TestRunnable, ThreadRunnable)
@@ -0,0 +1,109 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/data_plane/send_window.hpp"
+
+#include <boost/fiber/fiber.hpp>
+#include <boost/fiber/operations.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using namespace srf;
+using namespace srf::internal::data_plane;
+
+class TestSendWindow : public ::testing::Test
+{};
+
+TEST_F(TestSendWindow, BlocksWhenFullAndReleases)
+{
+    SendWindow window(2);
+    std::atomic<std::size_t> acquired{0};
+
+    std::vector<boost::fibers::fiber> senders;
+    for (int i = 0; i < 3; ++i)
+    {
+        senders.emplace_back([&] {
+            window.acquire();
+            ++acquired;
+        });
+    }
+
+    boost::this_fiber::yield();
+    EXPECT_EQ(acquired, 2);
+    EXPECT_EQ(window.in_flight(), 2);
+
+    // retiring a completion admits the waiting sender
+    window.release();
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+    EXPECT_EQ(acquired, 3);
+    EXPECT_EQ(window.in_flight(), 2);
+
+    window.release();
+    window.release();
+    EXPECT_EQ(window.in_flight(), 0);
+}
+
+TEST_F(TestSendWindow, AwaitIdle)
+{
+    SendWindow window(4);
+    window.acquire();
+    window.acquire();
+
+    bool idle = false;
+    boost::fibers::fiber waiter([&] {
+        window.await_idle();
+        idle = true;
+    });
+
+    boost::this_fiber::yield();
+    EXPECT_FALSE(idle);
+
+    window.release();
+    boost::this_fiber::yield();
+    EXPECT_FALSE(idle);
+
+    window.release();
+    waiter.join();
+    EXPECT_TRUE(idle);
+}
+
+TEST_F(TestSendWindow, RaisingLimitWakesWaiters)
+{
+    SendWindow window(1);
+    window.acquire();
+
+    bool acquired = false;
+    boost::fibers::fiber sender([&] {
+        window.acquire();
+        acquired = true;
+    });
+
+    boost::this_fiber::yield();
+    EXPECT_FALSE(acquired);
+
+    window.set_limit(2);
+    sender.join();
+    EXPECT_TRUE(acquired);
+    EXPECT_EQ(window.limit(), 2);
+    EXPECT_EQ(window.in_flight(), 2);
+}
@@ -17,18 +17,27 @@
 
 #include <srf/options/topology.hpp>
 #include <srf/types.hpp>
+#include "internal/system/fiber_deadline_scheduler.hpp"
+#include "internal/system/fiber_idle_waiter.hpp"
 #include "internal/system/fiber_pool.hpp"
+#include "internal/system/fiber_ready_queue.hpp"
+#include "internal/system/fiber_scheduler_stats.hpp"
+#include "internal/system/fiber_stack_pool.hpp"
 #include "internal/system/fiber_task_queue.hpp"
+#include "internal/system/pinned_thread_pool.hpp"
 #include "internal/system/system.hpp"
 #include "internal/system/thread_pool.hpp"
 #include "internal/system/topology.hpp"
 #include "srf/core/bitmap.hpp"
 #include "srf/core/fiber_pool.hpp"
+#include "srf/constants.hpp"
+#include "srf/options/fiber_pool.hpp"
 #include "srf/options/options.hpp"
 #include "srf/utils/thread_local_shared_pointer.hpp"
 
 #include <glog/logging.h>
 #include <gtest/gtest.h>
+#include <boost/context/stack_context.hpp>
 #include <boost/fiber/future/async.hpp>
 #include <boost/fiber/future/future.hpp>
 #include <boost/fiber/operations.hpp>
@@ -133,6 +142,235 @@ TEST_F(TestSystem, FiberPool)
     EXPECT_EQ(s0.size(), 1);
 }
 
+TEST_F(TestSystem, FiberPoolWorkStealing)
+{
+    auto system = System::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0,1");
+        options.fiber_pool().enable_work_stealing(true);
+    }));
+
+    if (system->topology().cpu_set().weight() < 2)
+    {
+        GTEST_SKIP() << "At least two threads are required to test work stealing";
+    }
+
+    auto pool = system->make_fiber_pool(system->topology().cpu_set());
+
+    // all fibers are enqueued on the first thread; each blocks its thread after yielding, which leaves the
+    // remaining ready fibers for the idle thread to steal
+    std::vector<Future<std::thread::id>> futures;
+    for (int i = 0; i < 20; i++)
+    {
+        futures.push_back(pool->enqueue(0, [] {
+            boost::this_fiber::yield();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return std::this_thread::get_id();
+        }));
+    }
+
+    std::set<std::thread::id> ids;
+    for (auto& f : futures)
+    {
+        ids.insert(f.get());
+    }
+
+    EXPECT_GT(ids.size(), 1);
+}
+
+TEST_F(TestSystem, FiberIdleWaiterBusyPoll)
+{
+    system::FiberIdleWaiter waiter(std::chrono::milliseconds(50));
+
+    // a notify issued while polling is observed without blocking
+    std::thread notifier([&waiter] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        waiter.notify();
+    });
+    waiter.wait_until((std::chrono::steady_clock::time_point::max)());
+    notifier.join();
+
+    // a deadline shorter than the busy poll timeout is honored
+    auto start = std::chrono::steady_clock::now();
+    waiter.wait_until(start + std::chrono::milliseconds(5));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5));
+
+    // once the busy poll timeout expires, the waiter falls back to blocking and is still woken by notify
+    notifier = std::thread([&waiter] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        waiter.notify();
+    });
+    waiter.wait_until((std::chrono::steady_clock::time_point::max)());
+    notifier.join();
+}
+
+TEST_F(TestSystem, FiberSchedulerTelemetry)
+{
+    auto system = System::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0");
+        options.fiber_pool().enable_scheduler_telemetry(true);
+    }));
+
+    auto queue = system->get_task_queue(0);
+    auto stats = queue->stats();
+    ASSERT_NE(stats, nullptr);
+
+    auto switches = stats->context_switches.load();
+
+    queue
+        ->enqueue([] {
+            for (int i = 0; i < 10; i++)
+            {
+                boost::this_fiber::yield();
+            }
+        })
+        .get();
+
+    EXPECT_GE(stats->context_switches.load() - switches, 10);
+    EXPECT_GT(stats->run_ns_by_priority[system::FiberReadyQueue::bucket_index(SRF_DEFAULT_FIBER_PRIORITY)].load(), 0);
+
+    // the queue blocks while waiting for work
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue->enqueue([] {}).get();
+    EXPECT_GT(stats->idle_periods.load(), 0);
+}
+
+TEST_F(TestSystem, FiberSchedulerTelemetryDisabled)
+{
+    auto system = System::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0");
+        options.fiber_pool().enable_scheduler_telemetry(false);
+    }));
+
+    EXPECT_EQ(system->get_task_queue(0)->stats(), nullptr);
+}
+
+TEST_F(TestSystem, FiberStackPool)
+{
+    system::FiberStackPool pool(64 * 1024, true, 2);
+    EXPECT_GE(pool.stack_size(), 64 * 1024);
+
+    std::vector<boost::context::stack_context> stacks;
+    for (int i = 0; i < 3; i++)
+    {
+        stacks.push_back(pool.allocate());
+        // the usable region is writable up to the top of the stack
+        static_cast<char*>(stacks.back().sp)[-1] = 42;
+    }
+    EXPECT_EQ(pool.mapped_count(), 3);
+
+    // only two stacks are retained
+    for (auto& sctx : stacks)
+    {
+        pool.deallocate(sctx);
+    }
+
+    auto sctx = pool.allocate();
+    EXPECT_EQ(pool.mapped_count(), 3);
+    EXPECT_EQ(pool.reused_count(), 1);
+    pool.deallocate(sctx);
+}
+
+TEST_F(TestSystem, FiberTaskQueueReusesStacks)
+{
+    auto system = System::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0");
+        options.fiber_pool().stack_size(128 * 1024);
+    }));
+
+    auto queue = system->get_task_queue(0);
+    EXPECT_GE(queue->stack_pool().stack_size(), 128 * 1024);
+
+    for (int i = 0; i < 10; i++)
+    {
+        queue->enqueue([] {}).get();
+    }
+
+    // sequential fibers run on the same recycled stack
+    EXPECT_LE(queue->stack_pool().mapped_count(), 2);
+    EXPECT_GE(queue->stack_pool().reused_count(), 9);
+}
+
+TEST_F(TestSystem, FiberTaskQueueDetachedAndBatchEnqueue)
+{
+    auto system = System::make_system(make_options([](Options& options) { options.topology().user_cpuset("0"); }));
+
+    auto queue = system->get_task_queue(0);
+    std::atomic<int> counter{0};
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; p++)
+    {
+        producers.emplace_back([&] {
+            for (int i = 0; i < 100; i++)
+            {
+                queue->enqueue_detached([&counter] { ++counter; });
+            }
+        });
+    }
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+
+    std::vector<std::function<void()>> batch(50, [&counter] { counter += 2; });
+    queue->enqueue_detached_batch(FiberMetaData{}, batch.begin(), batch.end());
+
+    // the queue runs tasks in submission order per producer, but detached fibers may still be in flight
+    while (queue->enqueue([&counter] { return counter.load(); }).get() != 500)
+    {
+        boost::this_fiber::yield();
+    }
+    EXPECT_EQ(counter, 500);
+}
+
+TEST_F(TestSystem, FiberDeadlineScheduling)
+{
+    using namespace std::chrono_literals;
+
+    auto system = System::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0");
+        options.fiber_pool().enable_deadline_scheduling(true);
+    }));
+
+    std::vector<int> order;
+    system->get_task_queue(0)
+        ->enqueue([&order] {
+            struct Spec
+            {
+                int id;
+                int priority;
+                std::chrono::nanoseconds deadline;
+            };
+            std::vector<Spec> specs{{0, 31, 0ns}, {1, 10, 10ms}, {2, -5, 1ms}, {3, 0, 5ms}, {4, -32, 0ns}};
+            std::vector<boost::fibers::fiber> fibers;
+            for (const auto& spec : specs)
+            {
+                boost::fibers::fiber fiber([&order, id = spec.id] { order.push_back(id); });
+                auto& props = fiber.properties<system::FiberPriorityProps>();
+                props.set_priority(spec.priority);
+                props.set_relative_deadline(spec.deadline);
+                fibers.push_back(std::move(fiber));
+            }
+            for (auto& fiber : fibers)
+            {
+                fiber.join();
+            }
+        })
+        .get();
+
+    // earliest deadline first regardless of priority; fibers without a deadline follow in priority order
+    EXPECT_EQ(order, (std::vector<int>{2, 3, 1, 0, 4}));
+}
+
+TEST_F(TestSystem, FiberDeadlineSchedulingExcludesWorkStealing)
+{
+    EXPECT_ANY_THROW(System::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0,1");
+        options.fiber_pool().enable_work_stealing(true);
+        options.fiber_pool().enable_deadline_scheduling(true);
+    })));
+}
+
 TEST_F(TestSystem, ImpossibleCoreCount)
 {
     auto system = System::make_system(make_options([](Options& options) {
@@ -277,3 +515,38 @@ TEST_F(TestSystem, ThreadPool)
     EXPECT_EQ(counter, 3);
     EXPECT_EQ(ids.size(), 2);
 }
+
+TEST_F(TestSystem, PinnedThreadPool)
+{
+    auto system = System::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0-1");
+        options.topology().restrict_gpus(true);
+    }));
+
+    auto pool = std::make_shared<system::PinnedThreadPool>(system);
+
+    std::thread::id first_id;
+    pool->enqueue(1, [&] {
+            EXPECT_EQ(system->get_current_thread_affinity().first(), 1);
+            first_id = std::this_thread::get_id();
+        })
+        .get();
+
+    // a completed task returns its thread to the pool
+    std::thread::id second_id;
+    pool->enqueue(1, [&] { second_id = std::this_thread::get_id(); }).get();
+    EXPECT_EQ(first_id, second_id);
+    EXPECT_EQ(pool->thread_count(), 1);
+    EXPECT_EQ(pool->reused_count(), 1);
+
+    // concurrent tasks on the same cpu get their own threads; other cpus never share threads
+    Promise<void> release;
+    auto released = release.get_future().share();
+    auto blocked  = pool->enqueue(1, [released] { released.get(); });
+    pool->enqueue(1, [] {}).get();
+    pool->enqueue(0, [&] { EXPECT_EQ(system->get_current_thread_affinity().first(), 0); }).get();
+    release.set_value();
+    blocked.get();
+
+    EXPECT_EQ(pool->thread_count(), 3);
+}
@@ -209,3 +209,27 @@ TEST_F(TestTopology, Codable)
         EXPECT_EQ(info.pcie_bus_id(), decoded->gpu_info().at(id).pcie_bus_id());
     }
 }
+
+TEST_F(TestTopology, CoreSpreadOrder)
+{
+    // 4 physical cores with 2 hardware threads each; core i owns logical cpus 2i and 2i+1
+    hwloc_topology_t system_topology;
+    CHECK_HWLOC(hwloc_topology_init(&system_topology));
+    CHECK_HWLOC(hwloc_topology_set_synthetic(system_topology, "package:1 core:4 pu:2"));
+    CHECK_HWLOC(hwloc_topology_load(system_topology));
+
+    CpuSet machine_cpu_set("0-7");
+    auto topology = internal::system::Topology::Create(TopologyOptions{}, system_topology, machine_cpu_set, {});
+    EXPECT_EQ(topology->core_count(), 4);
+    EXPECT_EQ(topology->cpu_count(), 8);
+
+    std::vector<std::uint32_t> all_cores{0, 2, 4, 6, 1, 3, 5, 7};
+    EXPECT_EQ(topology->core_spread_order(topology->cpu_set()), all_cores);
+
+    // a partial cpu_set spreads across the cores it touches before using the remaining smt siblings
+    std::vector<std::uint32_t> partial{0, 2, 4, 1, 3};
+    EXPECT_EQ(topology->core_spread_order(CpuSet("0-4")), partial);
+
+    std::vector<std::uint32_t> siblings_only{1, 3};
+    EXPECT_EQ(topology->core_spread_order(CpuSet("1,3")), siblings_only);
+}
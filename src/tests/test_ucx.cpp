@@ -17,6 +17,7 @@
 
 #include "internal/ucx/all.hpp"
 #include "internal/ucx/endpoint.hpp"
+#include "internal/ucx/event_waker.hpp"
 #include "srf/channel/forward.hpp"
 #include "srf/types.hpp"
 
@@ -82,6 +83,25 @@ TEST_F(TestUCX, EndpointsInProcess)
     worker_1->progress();
     worker_2->progress();
 }
+
+TEST_F(TestUCX, WorkerEvents)
+{
+    auto worker = std::make_shared<Worker>(m_context);
+    ASSERT_GE(worker->efd(), 0);
+
+    while (!worker->arm())
+    {
+        worker->progress();
+    }
+
+    EventWaker waker(worker->efd());
+    EXPECT_FALSE(waker.await_event(std::chrono::milliseconds(1)));
+
+    // a sleeping progress engine is woken at shutdown by notify rather than by a network event
+    waker.notify();
+    EXPECT_TRUE(waker.await_event(std::chrono::seconds(5)));
+}
+
 /*
 TEST_F(TestUCX, ReceiveManager)
 {
@@ -0,0 +1,172 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_codable.hpp"
+#include "../test_srf.hpp"  // IWYU pragma: associated
+
+#include <srf/protos/codable.pb.h>
+#include <srf/codable/contiguous_types.hpp>
+#include <srf/codable/decode.hpp>
+#include <srf/codable/encode.hpp>
+#include <srf/codable/encoded_object.hpp>
+#include <srf/codable/encoded_object_pool.hpp>
+#include <srf/codable/encoding_options.hpp>
+#include <srf/codable/fundamental_types.hpp>
+#include <srf/codable/memory_resources.hpp>
+#include <srf/codable/protobuf_message.hpp>
+#include <srf/utils/thread_local_shared_pointer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// this executable replaces the global operator new to count the heap allocations of the calling thread; it is kept
+// separate from test_srf so the replacement does not apply to unrelated tests
+
+using namespace codable;
+
+namespace {
+
+// heap allocations made by the current thread while t_count_allocations is set
+thread_local bool t_count_allocations        = false;
+thread_local std::size_t t_allocation_count = 0;
+
+}  // namespace
+
+void* operator new(std::size_t bytes)
+{
+    if (t_count_allocations)
+    {
+        ++t_allocation_count;
+    }
+    if (auto* ptr = std::malloc(bytes == 0 ? 1 : bytes))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*bytes*/) noexcept
+{
+    std::free(ptr);
+}
+
+TEST_CLASS(CodableAllocations);
+
+TEST_F(TestCodableAllocations, EncodedObjectReuseDoesNotAllocate)
+{
+    auto resources = std::make_shared<CountingMemoryResources>();
+    utils::ThreadLocalSharedPointer<MemoryResources>::set(resources);
+
+    // one eager, one coalesced host buffer, one dedicated host buffer and one remote descriptor
+    std::string eager("eager payload");
+    protos::Object small;
+    small.set_type_index_hash(42);
+    protos::EagerDescriptor large;
+    large.set_data(std::string(2048, 'x'));
+    std::vector<std::uint8_t> remote(4096, 7);
+
+    EncodingOptions buffered;
+    buffered.eager_threshold(0);
+
+    auto encoded    = EncodedObjectPool::acquire();
+    auto encode_all = [&] {
+        encode(eager, *encoded);
+        encode(small, *encoded, buffered);
+        encode(large, *encoded, buffered);
+        encode(remote, *encoded, buffered);
+    };
+
+    encode_all();
+    encoded->reset();
+    auto host_allocations = resources->host().allocations();
+    EXPECT_GT(host_allocations, 0);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        t_allocation_count  = 0;
+        t_count_allocations = true;
+        encode_all();
+        t_count_allocations = false;
+
+        EXPECT_EQ(t_allocation_count, 0);
+        EXPECT_EQ(resources->host().allocations(), host_allocations);
+
+        EXPECT_EQ(encoded->object_count(), 4);
+        EXPECT_EQ(decode<std::string>(*encoded, 0), eager);
+        EXPECT_EQ(decode<protos::Object>(*encoded, 1).type_index_hash(), 42);
+        EXPECT_EQ(decode<protos::EagerDescriptor>(*encoded, 2).data(), large.data());
+        EXPECT_EQ(encoded->memory_block(3).data(), remote.data());
+        encoded->reset();
+    }
+}
+
+TEST_F(TestCodableAllocations, FlatDescriptorsDecodeInPlace)
+{
+    std::string str("decoded from the flat descriptors");
+    double pi = 3.14159;
+    std::vector<float> vec{1.0, 2.0, 3.0, 4.0};
+
+    EncodingOptions options;
+    options.descriptor_format(DescriptorFormat::Flat);
+
+    EncodedObject sent;
+    encode(str, sent, options);
+    encode(pi, sent, options);
+    encode(vec, sent, EncodingOptions(options).eager_threshold(0));
+
+    std::vector<std::uint8_t> buffer(sent.serialized_descriptor_bytes());
+    EXPECT_EQ(sent.serialize_descriptors(buffer.data(), buffer.size()), buffer.size());
+
+    EncodedObject received;
+    received.deserialize_descriptors(buffer.data(), buffer.size());
+
+    // the received copy is reused, and reading through the view neither parses nor allocates
+    t_allocation_count  = 0;
+    t_count_allocations = true;
+    received.deserialize_descriptors(buffer.data(), buffer.size());
+    auto decoded_pi     = decode<double>(received, 1);
+    auto block          = received.memory_block(2);
+    t_count_allocations = false;
+    EXPECT_EQ(t_allocation_count, 0);
+
+    EXPECT_EQ(received.descriptor_format(), DescriptorFormat::Flat);
+    EXPECT_EQ(received.object_count(), 3);
+    EXPECT_EQ(received.descriptor_count(), 3);
+    EXPECT_DOUBLE_EQ(decoded_pi, pi);
+    EXPECT_EQ(decode<std::string>(received, 0), str);
+    EXPECT_EQ(block.data(), vec.data());
+    EXPECT_EQ((decode<std::vector<float>>(received, 2)), vec);
+
+    // forwarding re-sends the received bytes
+    std::vector<std::uint8_t> forwarded(received.serialized_descriptor_bytes());
+    EXPECT_EQ(received.serialize_descriptors(forwarded.data(), forwarded.size()), forwarded.size());
+    EXPECT_EQ(forwarded, buffer);
+
+    // the protobuf message is rebuilt on demand
+    EXPECT_EQ(received.proto().SerializeAsString(), sent.proto().SerializeAsString());
+    EXPECT_EQ(received.eager_descriptor(1).data().size(), sizeof(double));
+}
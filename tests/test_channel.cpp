@@ -35,6 +35,7 @@
 #include <cstdint>     // for uint64_t
 #include <functional>  // for ref, reference_wrapper
 #include <memory>
+#include <string>
 #include <utility>
 // IWYU thinks algorithm is needed for: auto channel = std::make_shared<RecentChannel<int>>(2);
 // IWYU pragma: no_include <algorithm>
@@ -173,6 +174,36 @@ TEST_F(TestChannel, BufferedChannel)
     EXPECT_GE(t, 0.1);
 }
 
+TEST_F(TestChannel, BufferedChannelTryWrite)
+{
+    auto channel = std::make_shared<BufferedChannel<std::string>>(2);
+
+    channel::Ingress<std::string>& ingress = *channel;
+    channel::Egress<std::string>& egress   = *channel;
+
+    // a capacity 2 buffered_channel holds a single element before reporting full
+    std::string value = "first";
+    EXPECT_EQ(ingress.try_write(std::move(value)), channel::Status::success);
+
+    value = "second";
+    EXPECT_EQ(ingress.try_write(std::move(value)), channel::Status::full);
+
+    // a failed try_write must not consume the value
+    EXPECT_EQ(value, "second");
+
+    std::string output;
+    egress.await_read(std::ref(output));
+    EXPECT_EQ(output, "first");
+
+    EXPECT_EQ(ingress.try_write(std::move(value)), channel::Status::success);
+    egress.await_read(std::ref(output));
+    EXPECT_EQ(output, "second");
+
+    channel->close_channel();
+    value = "closed";
+    EXPECT_EQ(ingress.try_write(std::move(value)), channel::Status::closed);
+}
+
 TEST_F(TestChannel, RecentChannel)
 {
     auto channel = std::make_shared<RecentChannel<int>>(2);
@@ -15,22 +15,39 @@
  * limitations under the License.
  */
 
+#include "test_codable.hpp"
 #include "test_srf.hpp"  // IWYU pragma: associated
 
 #include <srf/protos/codable.pb.h>
 #include <srf/codable/codable_protocol.hpp>
+#include <srf/codable/composite_types.hpp>
+#include <srf/codable/compression.hpp>
+#include <srf/codable/contiguous_types.hpp>
 #include <srf/codable/decode.hpp>
 #include <srf/codable/encode.hpp>
 #include <srf/codable/encoded_object.hpp>
+#include <srf/codable/encoded_object_pool.hpp>
 #include <srf/codable/encoding_options.hpp>
+#include <srf/codable/flat_descriptor.hpp>
 #include <srf/codable/fundamental_types.hpp>
+#include <srf/codable/memory_resources.hpp>
 #include <srf/codable/protobuf_message.hpp>
 #include <srf/codable/type_traits.hpp>
+#include <srf/utils/thread_local_shared_pointer.hpp>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
 
 using namespace codable;
 
@@ -80,6 +97,53 @@ namespace srf::codable {}
 struct NotCodableObject
 {};
 
+struct TriviallyCodableObject
+{
+    std::int32_t id;
+    double value;
+};
+
+namespace srf::codable {
+
+template <>
+struct is_trivially_codable<TriviallyCodableObject> : std::true_type
+{};
+
+}  // namespace srf::codable
+
+struct ReflectedObject
+{
+    std::uint32_t id;
+    std::string name;
+    std::optional<double> score;
+    std::vector<std::uint16_t> values;
+};
+
+struct NotReflectableObject
+{
+    int* ptr;
+    std::string name;
+};
+
+struct CArrayObject
+{
+    int values[3];
+    std::string name;
+};
+
+struct DerivedObject : ReflectedObject
+{
+    int extra;
+};
+
+struct EmptyBase
+{};
+
+struct DerivedFromEmptyObject : EmptyBase
+{
+    std::string name;
+};
+
 TEST_CLASS(Codable);
 
 TEST_F(TestCodable, Objects)
@@ -155,3 +219,342 @@ TEST_F(TestCodable, EncodedObjectProto)
     static_assert(codable::is_decodable<protos::EncodedObject>::value, "should be decodable");
     static_assert(is_codable<protos::EncodedObject>::value, "should be codable");
 }
+
+TEST_F(TestCodable, ContiguousVector)
+{
+    static_assert(is_codable<std::vector<float>>::value, "should be codable");
+    static_assert(!is_encodable<std::vector<bool>>::value, "std::vector<bool> is not contiguous");
+
+    std::vector<float> vec{1.0, 2.0, 3.0, 4.0};
+
+    // below the eager threshold the payload is copied into the control message
+    auto eager = encode(vec);
+    EXPECT_TRUE(eager->proto().descriptors().at(0).has_eager_desc());
+    EXPECT_EQ(decode<std::vector<float>>(*eager), vec);
+
+    // above the eager threshold the encoding references the vector's memory
+    auto encoding = encode(vec, EncodingOptions().eager_threshold(0));
+    EXPECT_EQ(encoding->descriptor_count(), 1);
+    EXPECT_EQ(encoding->memory_block(0).data(), vec.data());
+    EXPECT_EQ(encoding->memory_block(0).bytes(), vec.size() * sizeof(float));
+
+    auto decoding = decode<std::vector<float>>(*encoding);
+    EXPECT_EQ(vec, decoding);
+
+    std::array<float, 8> storage{};
+    auto count = decode_into<std::vector<float>>(*encoding, 0, storage.data(), storage.size());
+    EXPECT_EQ(count, vec.size());
+    EXPECT_FLOAT_EQ(storage[3], 4.0);
+
+    EXPECT_ANY_THROW(decode_into<std::vector<float>>(*encoding, 0, storage.data(), 2));
+}
+
+TEST_F(TestCodable, ContiguousArray)
+{
+    static_assert(is_codable<std::array<std::uint64_t, 4>>::value, "should be codable");
+
+    std::array<std::uint64_t, 4> array{1, 2, 3, 42};
+    auto encoding = encode(array, EncodingOptions().eager_threshold(0));
+    EXPECT_EQ(encoding->memory_block(0).data(), array.data());
+
+    auto decoding = decode<std::array<std::uint64_t, 4>>(*encoding);
+    EXPECT_EQ(array, decoding);
+}
+
+TEST_F(TestCodable, TriviallyCodableStruct)
+{
+    static_assert(is_codable<TriviallyCodableObject>::value, "opted in; should be codable");
+    static_assert(!is_encodable<NotCodableObject>::value, "trivially copyable types must opt in");
+
+    TriviallyCodableObject obj{7, 3.14159};
+    auto encoding = encode(obj, EncodingOptions().eager_threshold(0));
+    EXPECT_EQ(encoding->memory_block(0).data(), &obj);
+
+    auto decoding = decode<TriviallyCodableObject>(*encoding);
+    EXPECT_EQ(decoding.id, 7);
+    EXPECT_DOUBLE_EQ(decoding.value, 3.14159);
+}
+
+TEST_F(TestCodable, CompositeStdTypes)
+{
+    static_assert(is_codable<std::pair<int, std::string>>::value, "should be codable");
+    static_assert(is_codable<std::tuple<int, float, std::string>>::value, "should be codable");
+    static_assert(is_codable<std::optional<std::string>>::value, "should be codable");
+    static_assert(is_codable<std::variant<int, std::string>>::value, "should be codable");
+    static_assert(is_codable<std::map<std::string, int>>::value, "should be codable");
+    static_assert(is_codable<std::unordered_map<int, std::vector<float>>>::value, "should be codable");
+    static_assert(is_codable<std::vector<std::string>>::value, "should be codable");
+    static_assert(!is_encodable<std::pair<int, NotCodableObject>>::value, "members must be packable");
+
+    auto pair = decode<std::pair<int, std::string>>(*encode(std::pair<int, std::string>{42, "srf"}));
+    EXPECT_EQ(pair.first, 42);
+    EXPECT_EQ(pair.second, "srf");
+
+    auto tuple = decode<std::tuple<int, float, std::string>>(*encode(std::tuple<int, float, std::string>{1, 2.0, "3"}));
+    EXPECT_EQ(std::get<0>(tuple), 1);
+    EXPECT_FLOAT_EQ(std::get<1>(tuple), 2.0);
+    EXPECT_EQ(std::get<2>(tuple), "3");
+
+    std::optional<std::string> empty;
+    EXPECT_FALSE(decode<std::optional<std::string>>(*encode(empty)).has_value());
+
+    std::variant<int, std::string> variant{std::string("alternative")};
+    auto decoded_variant = decode<std::variant<int, std::string>>(*encode(variant));
+    ASSERT_EQ(decoded_variant.index(), 1);
+    EXPECT_EQ(std::get<1>(decoded_variant), "alternative");
+
+    std::map<std::string, int> map{{"a", 1}, {"b", 2}};
+    EXPECT_EQ((decode<std::map<std::string, int>>(*encode(map))), map);
+
+    std::unordered_map<int, std::vector<float>> umap{{1, {1.0, 2.0}}, {2, {}}};
+    EXPECT_EQ((decode<std::unordered_map<int, std::vector<float>>>(*encode(umap))), umap);
+}
+
+TEST_F(TestCodable, ReflectedAggregate)
+{
+    static_assert(is_reflectable<ReflectedObject>::value, "aggregate should be reflectable");
+    static_assert(is_codable<ReflectedObject>::value, "should be codable");
+    static_assert(!is_encodable<NotReflectableObject>::value, "pointer fields are not packable");
+    static_assert(!is_reflectable<CodableObject>::value, "serialize members take precedence");
+    static_assert(!is_reflectable<TriviallyCodableObject>::value, "trivially codable types are not reflected");
+
+    // structured bindings would reject or miscount these; they must be excluded without a hard error
+    static_assert(!is_reflectable<CArrayObject>::value, "brace elision miscounts C-array members");
+    static_assert(!is_reflectable<DerivedObject>::value, "fields split across a base are not bindable");
+    static_assert(!is_reflectable<DerivedFromEmptyObject>::value, "bases are counted as fields");
+    static_assert(!is_encodable<CArrayObject>::value, "should NOT be encodable");
+    static_assert(!is_encodable<DerivedObject>::value, "should NOT be encodable");
+    static_assert(!is_encodable<DerivedFromEmptyObject>::value, "should NOT be encodable");
+
+    ReflectedObject obj{7, "reflected", 0.5, {1, 2, 3}};
+    auto encoding = encode(obj);
+
+    // all fields are packed into a single descriptor under a single object
+    EXPECT_EQ(encoding->object_count(), 1);
+    EXPECT_EQ(encoding->descriptor_count(), 1);
+    EXPECT_TRUE(encoding->proto().descriptors().at(0).has_eager_desc());
+
+    auto decoded = decode<ReflectedObject>(*encoding);
+    EXPECT_EQ(decoded.id, obj.id);
+    EXPECT_EQ(decoded.name, obj.name);
+    EXPECT_EQ(decoded.score, obj.score);
+    EXPECT_EQ(decoded.values, obj.values);
+}
+
+TEST_F(TestCodable, EncodedObjectPool)
+{
+    std::vector<int> values{1, 2, 3};
+    EncodedObject* recycled = nullptr;
+    {
+        auto encoded = EncodedObjectPool::acquire();
+        encode(values, *encoded);
+        EXPECT_EQ(encoded->object_count(), 1);
+        EXPECT_EQ((decode<std::vector<int>>(*encoded)), values);
+        recycled = encoded.get();
+    }
+    EXPECT_EQ(EncodedObjectPool::size(), 1);
+
+    // the released object is handed back out, reset and ready for a new encoding
+    auto encoded = EncodedObjectPool::acquire();
+    EXPECT_EQ(encoded.get(), recycled);
+    EXPECT_EQ(EncodedObjectPool::size(), 0);
+    EXPECT_EQ(encoded->object_count(), 0);
+    EXPECT_EQ(encoded->descriptor_count(), 0);
+
+    std::string str("reused");
+    encode(str, *encoded);
+    EXPECT_EQ(decode<std::string>(*encoded), str);
+
+    encoded->reset();
+    EXPECT_EQ(encoded->descriptor_count(), 0);
+}
+
+TEST_F(TestCodable, FlatDescriptorFormat)
+{
+    protos::EncodedObject proto;
+
+    auto* obj = proto.add_objects();
+    obj->set_type_index_hash(42);
+    obj->set_desc_id(0);
+
+    auto* remote = proto.add_descriptors()->mutable_remote_desc();
+    remote->set_instance_id(3);
+    remote->set_object_id(5);
+    remote->set_remote_address(0xdeadbeef);
+    remote->set_remote_bytes(1024);
+    remote->set_remote_key("rkey");
+    remote->set_memory_kind(protos::MemoryKind::Device);
+    remote->set_compression(lz_compressor()->id());
+    remote->set_uncompressed_bytes(4096);
+
+    auto* eager = proto.add_descriptors()->mutable_eager_desc();
+    eager->set_data("eager payload");
+    eager->set_memory_kind(protos::MemoryKind::Host);
+
+    protos::Object meta_data;
+    meta_data.set_type_index_hash(7);
+    proto.add_descriptors()->mutable_meta_data_desc()->mutable_meta_data()->PackFrom(meta_data);
+    proto.mutable_meta_data()->PackFrom(meta_data);
+
+    std::vector<std::uint8_t> buffer(flat::serialized_size(proto));
+    EXPECT_EQ(flat::serialize(proto, buffer.data(), buffer.size()), buffer.size());
+    EXPECT_TRUE(flat::is_flat(buffer.data(), buffer.size()));
+
+    // protobuf encodings are never mistaken for the flat format
+    auto serialized_proto = proto.SerializeAsString();
+    EXPECT_FALSE(flat::is_flat(serialized_proto.data(), serialized_proto.size()));
+
+    // read in place
+    flat::EncodedObjectView view(buffer.data(), buffer.size());
+    EXPECT_EQ(view.object_count(), 1);
+    EXPECT_EQ(view.descriptor_count(), 3);
+    EXPECT_EQ(view.type_index_hash_for_object(0), 42);
+    EXPECT_EQ(view.start_idx_for_object(0), 0);
+    EXPECT_EQ(view.kind(0), flat::DescriptorKind::Remote);
+    EXPECT_EQ(view.memory_kind(0), protos::MemoryKind::Device);
+    EXPECT_EQ(view.remote_address(0), 0xdeadbeef);
+    EXPECT_EQ(view.remote_bytes(0), 1024);
+    EXPECT_EQ(view.data(0), "rkey");
+    EXPECT_EQ(view.compression(0), lz_compressor()->id());
+    EXPECT_EQ(view.uncompressed_bytes(0), 4096);
+    EXPECT_EQ(view.kind(1), flat::DescriptorKind::Eager);
+    EXPECT_EQ(view.data(1), "eager payload");
+    EXPECT_EQ(view.kind(2), flat::DescriptorKind::MetaData);
+
+    // full round trip
+    protos::EncodedObject decoded;
+    flat::deserialize(buffer.data(), buffer.size(), decoded);
+    EXPECT_EQ(decoded.SerializeAsString(), serialized_proto);
+
+    EXPECT_ANY_THROW(flat::EncodedObjectView(buffer.data(), flat::header_bytes));
+}
+
+TEST_F(TestCodable, LzCompressor)
+{
+    auto lz = lz_compressor();
+    EXPECT_EQ(find_compressor(lz->id()), lz);
+    EXPECT_ANY_THROW(find_compressor(0xfeed));
+
+    std::string text;
+    for (int i = 0; i < 200; ++i)
+    {
+        text += R"({"id": )" + std::to_string(i) + R"(, "name": "srf", "values": [1, 2, 3]})";
+    }
+
+    std::vector<char> compressed(lz->max_compressed_bytes(text.size()));
+    auto bytes = lz->compress(text.data(), text.size(), compressed.data(), compressed.size());
+    EXPECT_GT(bytes, 0);
+    EXPECT_LT(bytes, text.size() / 4);
+
+    std::string decompressed(text.size(), '\0');
+    lz->decompress(compressed.data(), bytes, decompressed.data(), decompressed.size());
+    EXPECT_EQ(decompressed, text);
+
+    // a truncated block or a wrong uncompressed size is rejected
+    EXPECT_ANY_THROW(lz->decompress(compressed.data(), bytes / 2, decompressed.data(), decompressed.size()));
+    EXPECT_ANY_THROW(lz->decompress(compressed.data(), bytes, decompressed.data(), decompressed.size() - 1));
+
+    // incompressible blocks are reported as such
+    std::vector<std::uint8_t> noise(1024);
+    std::uint32_t state = 2463534242;
+    for (auto& byte : noise)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        byte = state & 0xff;
+    }
+    std::vector<char> out(lz->max_compressed_bytes(noise.size()));
+    EXPECT_EQ(lz->compress(noise.data(), noise.size(), out.data(), out.size()), 0);
+}
+
+TEST_F(TestCodable, Batch)
+{
+    std::vector<std::string> strings{"a", "bb", "ccc"};
+    auto encoding = encode_batch(strings);
+    EXPECT_EQ(encoding->object_count(), 3);
+    EXPECT_EQ(decode_batch<std::string>(*encoding), strings);
+    EXPECT_EQ(decode_batch<std::string>(*encoding, 1, 1), std::vector<std::string>{"bb"});
+
+    // batches append to an existing encoding
+    std::array<double, 2> doubles{1.0, 2.0};
+    encode_batch(doubles, *encoding);
+    EXPECT_EQ(encoding->object_count(), 5);
+    EXPECT_EQ(decode<std::string>(*encoding, 2), "ccc");
+
+    auto decoded = decode_batch<double>(*encoding, 3);
+    ASSERT_EQ(decoded.size(), 2);
+    EXPECT_EQ(decoded[0], 1.0);
+    EXPECT_EQ(decoded[1], 2.0);
+}
+
+TEST_F(TestCodable, CompressBatchOfCoalescedBuffers)
+{
+    auto resources = std::make_shared<CountingMemoryResources>();
+    utils::ThreadLocalSharedPointer<MemoryResources>::set(resources);
+
+    // serialized sizes from 129 to 512 bytes are carved from shared slabs; compressible and incompressible payloads are
+    // interleaved so compressed objects release their slab space while neighbors still point into the same slab
+    std::vector<protos::EagerDescriptor> batch;
+    std::uint32_t state = 2463534242;
+    for (std::size_t bytes = 130; bytes <= 500; bytes += 37)
+    {
+        std::string data;
+        if (batch.size() % 2 == 0)
+        {
+            while (data.size() < bytes)
+            {
+                data += "compressible payload ";
+            }
+            data.resize(bytes);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < bytes; ++i)
+            {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                data.push_back(static_cast<char>(state & 0xff));
+            }
+        }
+        batch.emplace_back().set_data(std::move(data));
+    }
+
+    auto encoding = encode_batch(batch, EncodingOptions().eager_threshold(0));
+    ASSERT_EQ(encoding->object_count(), batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        encoding->compress_object(i, *lz_compressor(), 128);
+    }
+    EXPECT_TRUE(encoding->is_compressed(0));
+    EXPECT_FALSE(encoding->is_compressed(1));
+
+    auto decoded = decode_batch<protos::EagerDescriptor>(*encoding);
+    ASSERT_EQ(decoded.size(), batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        EXPECT_EQ(decoded[i].data(), batch[i].data()) << "object " << i;
+    }
+
+    // a single small encoding allocates a slab of its own size rather than a full slab
+    auto host_allocations = resources->host().allocations();
+    auto host_bytes       = resources->host().allocated_bytes();
+    protos::Object small;
+    small.set_type_index_hash(42);
+    auto single = encode(small, EncodingOptions().eager_threshold(0));
+    EXPECT_EQ(resources->host().allocations(), host_allocations + 1);
+    EXPECT_EQ(resources->host().allocated_bytes(), host_bytes + alignof(std::max_align_t));
+    EXPECT_EQ(decode<protos::Object>(*single).type_index_hash(), 42);
+}
+
+TEST_F(TestCodable, EagerThreshold)
+{
+    std::vector<std::uint8_t> payload(256, 1);
+    EXPECT_EQ(EncodingOptions().eager_threshold(), default_eager_threshold());
+    EXPECT_FALSE(encode(payload)->proto().descriptors().at(0).has_eager_desc());
+
+    auto encoding = encode(payload, EncodingOptions().eager_threshold(1024));
+    EXPECT_TRUE(encoding->proto().descriptors().at(0).has_eager_desc());
+    EXPECT_EQ(decode<std::vector<std::uint8_t>>(*encoding), payload);
+}
@@ -0,0 +1,100 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2018-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <srf/codable/memory_resources.hpp>
+#include <srf/exceptions/runtime_error.hpp>
+#include <srf/memory/memory_kind.hpp>
+#include <srf/memory/resources/memory_resource.hpp>
+
+#include <cuda/memory_resource>
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace srf::codable {
+
+class CountingHostResource : public memory::memory_resource<::cuda::memory_kind::host>
+{
+  public:
+    CountingHostResource() : memory_resource("counting_host") {}
+    ~CountingHostResource() override = default;
+
+    std::size_t allocations() const
+    {
+        return m_allocations;
+    }
+
+    std::size_t allocated_bytes() const
+    {
+        return m_allocated_bytes;
+    }
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t /*alignment*/) final
+    {
+        ++m_allocations;
+        m_allocated_bytes += bytes;
+        return std::malloc(bytes);
+    }
+
+    // poisons released memory so that a use after free reads back corrupt data
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t /*alignment*/) final
+    {
+        std::memset(ptr, 0xdd, bytes);
+        std::free(ptr);
+    }
+
+    memory::memory_kind_type do_kind() const final
+    {
+        return memory::memory_kind_type::host;
+    }
+
+    std::size_t m_allocations{0};
+    std::size_t m_allocated_bytes{0};
+};
+
+class CountingMemoryResources : public MemoryResources
+{
+  public:
+    CountingMemoryResources() : m_host(std::make_shared<CountingHostResource>()), m_host_view(m_host) {}
+    ~CountingMemoryResources() override = default;
+
+    host_view_t host_resource_view() override
+    {
+        return m_host_view;
+    }
+
+    device_view_t device_resource_view() override
+    {
+        throw exceptions::SrfRuntimeError("no device memory resource");
+    }
+
+    const CountingHostResource& host() const
+    {
+        return *m_host;
+    }
+
+  private:
+    std::shared_ptr<CountingHostResource> m_host;
+    host_view_t m_host_view;
+};
+
+}  // namespace srf::codable
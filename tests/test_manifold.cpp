@@ -0,0 +1,191 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_srf.hpp"  // IWYU pragma: associated
+
+#include <srf/channel/buffered_channel.hpp>
+#include <srf/channel/status.hpp>
+#include <srf/manifold/egress.hpp>
+#include <srf/node/operators/operator.hpp>
+#include <srf/node/sink_channel.hpp>
+#include <srf/types.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace srf;
+
+namespace {
+
+// downstream segment input backed by a bounded channel; boost buffered channels hold capacity - 1 elements
+class TestSink : public node::SinkChannel<int>
+{
+  public:
+    TestSink(std::size_t capacity)
+    {
+        this->update_channel(std::make_unique<channel::BufferedChannel<int>>(capacity));
+    }
+
+    std::vector<int> drain()
+    {
+        std::vector<int> values;
+        int value;
+        while (this->egress().await_read_until(value, std::chrono::system_clock::now()) == channel::Status::success)
+        {
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    channel::Status read(int& value)
+    {
+        return this->egress().await_read(value);
+    }
+};
+
+// downstream input which can not report that it is full
+class BlockingSink : public node::Operator<int>
+{
+  public:
+    std::vector<int> values;
+
+  private:
+    channel::Status on_next(int&& data) final
+    {
+        values.push_back(data);
+        return channel::Status::success;
+    }
+
+    void on_complete() final {}
+};
+
+class TestManifold : public ::testing::Test
+{
+  protected:
+    using egress_t = manifold::LocalityAwareEgress<int>;
+
+    void add_output(SegmentAddress address, std::size_t host_partition, node::SinkProperties<int>& sink)
+    {
+        m_host_partitions[address] = host_partition;
+        static_cast<manifold::EgressDelegate&>(m_egress).add_output(address, &sink);
+    }
+
+    void SetUp() override
+    {
+        m_egress.set_host_partitions([this](const SegmentAddress& address) -> std::optional<std::size_t> {
+            auto search = m_host_partitions.find(address);
+            if (search == m_host_partitions.end())
+            {
+                return std::nullopt;
+            }
+            return search->second;
+        });
+    }
+
+    std::map<SegmentAddress, std::size_t> m_host_partitions;
+    egress_t m_egress;
+};
+
+}  // namespace
+
+TEST_F(TestManifold, LocalityAwareEgressPrefersProducerLocalOutputs)
+{
+    TestSink numa_0(4);
+    TestSink numa_1(4);
+    add_output(1, 0, numa_0);
+    add_output(2, 1, numa_1);
+
+    auto writer_0 = m_egress.make_writer(0);
+    auto writer_1 = m_egress.make_writer(1);
+
+    // locality is relative to each producer, not to the manifold
+    writer_0.await_write(10);
+    writer_1.await_write(20);
+    writer_0.await_write(11);
+    writer_1.await_write(21);
+
+    EXPECT_EQ(numa_0.drain(), std::vector<int>({10, 11}));
+    EXPECT_EQ(numa_1.drain(), std::vector<int>({20, 21}));
+    EXPECT_EQ(m_egress.local_writes(), 4);
+    EXPECT_EQ(m_egress.remote_writes(), 0);
+}
+
+TEST_F(TestManifold, LocalityAwareEgressSpillsWhenLocalOutputsAreFull)
+{
+    TestSink numa_0(4);
+    TestSink numa_1(8);
+    add_output(1, 0, numa_0);
+    add_output(2, 1, numa_1);
+
+    auto writer = m_egress.make_writer(0);
+    for (int i = 0; i < 6; ++i)
+    {
+        writer.await_write(int(i));
+    }
+
+    // the local output holds 3 values; the remainder spill to the remote output
+    EXPECT_EQ(numa_0.drain(), std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(numa_1.drain(), std::vector<int>({3, 4, 5}));
+    EXPECT_EQ(m_egress.local_writes(), 3);
+    EXPECT_EQ(m_egress.remote_writes(), 3);
+    EXPECT_EQ(m_egress.blocked_writes(), 0);
+}
+
+TEST_F(TestManifold, LocalityAwareEgressOutputsWithoutTryWrite)
+{
+    auto blocking = std::make_shared<BlockingSink>();
+    TestSink numa_1(8);
+    add_output(1, 0, *blocking);
+    add_output(2, 1, numa_1);
+
+    // a local output which can not report that it is full takes every write; nothing spills past it
+    auto writer = m_egress.make_writer(0);
+    for (int i = 0; i < 6; ++i)
+    {
+        writer.await_write(int(i));
+    }
+
+    EXPECT_EQ(blocking->values, std::vector<int>({0, 1, 2, 3, 4, 5}));
+    EXPECT_TRUE(numa_1.drain().empty());
+    EXPECT_EQ(m_egress.local_writes(), 6);
+}
+
+TEST_F(TestManifold, LocalityAwareEgressDropOutput)
+{
+    TestSink numa_0(4);
+    TestSink numa_1(4);
+    add_output(1, 0, numa_0);
+    add_output(2, 1, numa_1);
+
+    auto writer = m_egress.make_writer(0);
+    writer.await_write(1);
+
+    // the writer does not pin the outputs between writes, so a dropped output is closed immediately
+    m_egress.drop_output(1);
+    int value;
+    EXPECT_EQ(numa_0.read(value), channel::Status::success);
+    EXPECT_EQ(value, 1);
+    EXPECT_EQ(numa_0.read(value), channel::Status::closed);
+
+    writer.await_write(2);
+    EXPECT_EQ(numa_1.drain(), std::vector<int>({2}));
+    EXPECT_EQ(m_egress.output_count(), 1);
+}
@@ -18,6 +18,8 @@
 #include "./test_srf.hpp"  // IWYU pragma: associated
 
 #include <srf/metrics/counter.hpp>
+#include <srf/metrics/gauge.hpp>
+#include <srf/metrics/histogram.hpp>
 #include <srf/metrics/registry.hpp>
 
 #include <gtest/gtest.h>  // for AssertionResult, SuiteApiResolver, TestInfo, EXPECT_TRUE, Message, TEST_F, Test, TestFactoryImpl, TestPartResult
@@ -52,3 +54,28 @@ TEST_F(TestMetrics, ThroughputCounter)
     EXPECT_EQ(report[0].name, "test_counter");
     EXPECT_EQ(report[0].count, 43);
 }
+
+TEST_F(TestMetrics, GaugeHistogramAndCollectors)
+{
+    auto gauge     = m_registry->make_gauge("test_gauge", {{"name", "gauge"}});
+    auto histogram = m_registry->make_histogram("test_histogram", {{"name", "histogram"}}, {1.0, 10.0});
+
+    int collected = 0;
+    m_registry->add_collector([&] {
+        ++collected;
+        gauge.set(collected);
+    });
+
+    histogram.observe(5.0);
+    histogram.observe_multiple({1.0, 0.0, 2.0}, 100.0);
+
+    auto text = m_registry->export_text();
+    EXPECT_EQ(collected, 1);
+
+    EXPECT_NE(text.find("test_gauge{name=\"gauge\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("test_histogram_count{name=\"histogram\"} 4"), std::string::npos);
+    EXPECT_NE(text.find("test_histogram_sum{name=\"histogram\"} 105"), std::string::npos);
+
+    m_registry->export_text();
+    EXPECT_EQ(collected, 2);
+}